@@ -0,0 +1,459 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "../Packet/Matrix44Packet.h"
+#include "../Quaternion/Quaternion.h"
+#include "../Stream/Vector3Stream.h"
+#include "../Stream/Vector4Stream.h"
+
+#include <algorithm>
+
+namespace QuickMath
+{
+	/**
+	 * Rotation blend method of the pose blends.
+	 * Nlerp is the cheapest. FastSlerp corrects the nlerp factor with a polynomial fit, which brings the angular speed within about
+	 * 0.1% of a real slerp without any trigonometry.
+	 */
+	enum class RotationBlend : unsigned char
+	{
+		Nlerp,
+		FastSlerp
+	};
+
+	/**
+	 * Structure-of-arrays joint pose buffer.
+	 * Each joint has a rotation (a quaternion), a translation and a scale, stored in a Vector4Stream and two Vector3Streams. The blend
+	 * kernels process NativePacket::Lanes joints (4, 8 or 16 depending on the instruction set) per instruction.
+	 * A joint transforms a point p to rotation.Rotate(p * scale) + translation.
+	 */
+	class Pose final
+	{
+		typedef NativePacket PacketType;
+		typedef Vector4Packet<NativePacket> RotationPacket;
+		typedef Vector3Packet<NativePacket> VectorPacket;
+
+	public:
+		Pose() = default;
+
+		/**
+		 * Construct the pose with a number of identity joints.
+		 *
+		 * @param size: The number of joints.
+		 */
+		explicit Pose(size_t size) { Resize(size); }
+
+		/**
+		 * Get the number of joints.
+		 *
+		 * @return The size.
+		 */
+		size_t Size() const { return rotations.Size(); }
+
+		/**
+		 * Resize the pose. The existing joints are kept, and the new joints are identity.
+		 *
+		 * @param newSize: The new number of joints.
+		 */
+		void Resize(size_t newSize)
+		{
+			const size_t oldSize = Size();
+			rotations.Resize(newSize);
+			translations.Resize(newSize);
+			scales.Resize(newSize);
+
+			for (size_t joint = oldSize; joint < newSize; joint++)
+			{
+				rotations.Set(joint, Vector4(0.0f, 0.0f, 0.0f, 1.0f));
+				translations.Set(joint, Vector3(0.0f));
+				scales.Set(joint, Vector3(1.0f));
+			}
+		}
+
+		/**
+		 * Get the rotation of a joint.
+		 *
+		 * @param joint: The index of the joint.
+		 * @return The rotation.
+		 */
+		Quaternion GetRotation(size_t joint) const { return rotations.Get(joint).intrinsic; }
+
+		/**
+		 * Get the translation of a joint.
+		 *
+		 * @param joint: The index of the joint.
+		 * @return The translation.
+		 */
+		Vector3 GetTranslation(size_t joint) const { return translations.Get(joint); }
+
+		/**
+		 * Get the scale of a joint.
+		 *
+		 * @param joint: The index of the joint.
+		 * @return The scale.
+		 */
+		Vector3 GetScale(size_t joint) const { return scales.Get(joint); }
+
+		/**
+		 * Set a joint.
+		 *
+		 * @param joint: The index of the joint.
+		 * @param rotation: The rotation.
+		 * @param translation: The translation.
+		 * @param scale: The scale.
+		 */
+		void Set(size_t joint, const Quaternion& rotation, const Vector3& translation, const Vector3& scale)
+		{
+			rotations.Set(joint, rotation.intrinsic);
+			translations.Set(joint, translation);
+			scales.Set(joint, scale);
+		}
+
+		/**
+		 * Get the rotation stream.
+		 *
+		 * @return The stream.
+		 */
+		const Vector4Stream& Rotations() const { return rotations; }
+
+		/**
+		 * Get the translation stream.
+		 *
+		 * @return The stream.
+		 */
+		const Vector3Stream& Translations() const { return translations; }
+
+		/**
+		 * Get the scale stream.
+		 *
+		 * @return The stream.
+		 */
+		const Vector3Stream& Scales() const { return scales; }
+
+		/**
+		 * Blend two poses with one factor for all the joints.
+		 * The translations and scales are interpolated linearly, and the rotations along the shortest path.
+		 * The result may be one of the inputs.
+		 *
+		 * @param from: The pose at factor 0.
+		 * @param to: The pose at factor 1. It must have the same size as from.
+		 * @param factor: The blend factor.
+		 * @param result: The blended pose. It is resized to the size of the inputs.
+		 * @param method: The rotation blend method. Default is Nlerp.
+		 */
+		static void Blend(const Pose& from, const Pose& to, float factor, Pose& result, RotationBlend method = RotationBlend::Nlerp)
+		{
+			result.Resize(from.Size());
+			for (size_t i = 0; i < result.rotations.Stride(); i += PacketType::Lanes)
+				BlendPacket(from, to, PacketType(factor), result, i, method);
+		}
+
+		/**
+		 * Blend two poses with a factor per joint (for example a bone mask).
+		 * The result may be one of the inputs.
+		 *
+		 * @param from: The pose at factor 0.
+		 * @param to: The pose at factor 1. It must have the same size as from.
+		 * @param factors: The blend factors, one per joint.
+		 * @param result: The blended pose. It is resized to the size of the inputs.
+		 * @param method: The rotation blend method. Default is Nlerp.
+		 */
+		static void Blend(const Pose& from, const Pose& to, const float* factors, Pose& result, RotationBlend method = RotationBlend::Nlerp)
+		{
+			const size_t size = from.Size();
+			result.Resize(size);
+			for (size_t i = 0; i < result.rotations.Stride(); i += PacketType::Lanes)
+				BlendPacket(from, to, LoadFactors(factors, i, size), result, i, method);
+		}
+
+		/**
+		 * Blend any number of poses (tracks) with a weight per pose.
+		 * The weights should add up to 1. The rotations are summed in the hemisphere of the first pose and normalized.
+		 * The result may be one of the inputs.
+		 *
+		 * @param poses: The poses. They must have the same size.
+		 * @param weights: The weights, one per pose.
+		 * @param count: The number of poses. It must not be 0.
+		 * @param result: The blended pose. It is resized to the size of the inputs.
+		 */
+		static void BlendWeighted(const Pose* poses, const float* weights, size_t count, Pose& result)
+		{
+			result.Resize(poses[0].Size());
+			for (size_t i = 0; i < result.rotations.Stride(); i += PacketType::Lanes)
+			{
+				const RotationPacket first = LoadRotations(poses[0].rotations, i);
+				const PacketType firstWeight(weights[0]);
+
+				RotationPacket rotation = first * firstWeight;
+				VectorPacket translation = LoadVectors(poses[0].translations, i) * firstWeight;
+				VectorPacket scale = LoadVectors(poses[0].scales, i) * firstWeight;
+
+				for (size_t pose = 1; pose < count; pose++)
+				{
+					const RotationPacket other = LoadRotations(poses[pose].rotations, i);
+					const PacketType weight(weights[pose]);
+
+					rotation = other.MulAdd(weight * HemisphereSign(first.Dot(other)), rotation);
+					translation = LoadVectors(poses[pose].translations, i).MulAdd(weight, translation);
+					scale = LoadVectors(poses[pose].scales, i).MulAdd(weight, scale);
+				}
+
+				StoreRotations(result.rotations, i, rotation.Normalize());
+				StoreVectors(result.translations, i, translation);
+				StoreVectors(result.scales, i, scale);
+			}
+		}
+
+		/**
+		 * Create an additive layer, the difference of a pose from a reference pose.
+		 * The rotation is pose * reference^-1, the translation pose - reference and the scale pose / reference.
+		 * The result may be one of the inputs.
+		 *
+		 * @param pose: The pose.
+		 * @param reference: The reference pose. It must have the same size as pose.
+		 * @param result: The additive layer. It is resized to the size of the inputs.
+		 */
+		static void MakeAdditive(const Pose& pose, const Pose& reference, Pose& result)
+		{
+			result.Resize(pose.Size());
+			for (size_t i = 0; i < result.rotations.Stride(); i += PacketType::Lanes)
+			{
+				const RotationPacket referenceRotation = LoadRotations(reference.rotations, i);
+				const RotationPacket inverse(-referenceRotation.x, -referenceRotation.y, -referenceRotation.z, referenceRotation.w);
+
+				StoreRotations(result.rotations, i, Multiply(LoadRotations(pose.rotations, i), inverse));
+				StoreVectors(result.translations, i, LoadVectors(pose.translations, i) - LoadVectors(reference.translations, i));
+				StoreVectors(result.scales, i, LoadVectors(pose.scales, i) / LoadVectors(reference.scales, i));
+			}
+		}
+
+		/**
+		 * Apply an additive layer (from MakeAdditive) on top of a pose.
+		 * The layer is scaled by the weight first: its rotation is nlerped from identity and its translation and scale are interpolated
+		 * from 0 and 1. The result may be one of the inputs.
+		 *
+		 * @param base: The base pose.
+		 * @param additive: The additive layer. It must have the same size as base.
+		 * @param weight: The weight of the layer.
+		 * @param result: The layered pose. It is resized to the size of the inputs.
+		 */
+		static void ApplyAdditive(const Pose& base, const Pose& additive, float weight, Pose& result)
+		{
+			const PacketType factor(weight);
+			const RotationPacket identity(PacketType(0.0f), PacketType(0.0f), PacketType(0.0f), PacketType(1.0f));
+
+			result.Resize(base.Size());
+			for (size_t i = 0; i < result.rotations.Stride(); i += PacketType::Lanes)
+			{
+				const RotationPacket delta = BlendRotations(identity, LoadRotations(additive.rotations, i), factor, RotationBlend::Nlerp);
+				const VectorPacket scale = (LoadVectors(additive.scales, i) - 1.0f).MulAdd(factor, VectorPacket(1.0f));
+
+				StoreRotations(result.rotations, i, Multiply(delta, LoadRotations(base.rotations, i)));
+				StoreVectors(result.translations, i, LoadVectors(additive.translations, i).MulAdd(factor, LoadVectors(base.translations, i)));
+				StoreVectors(result.scales, i, LoadVectors(base.scales, i) * scale);
+			}
+		}
+
+		/**
+		 * Convert the joints to a matrix palette.
+		 * Each matrix is translation * rotation * scale, in the Matrix44 * Vector4 convention. The rotations must be normalized.
+		 *
+		 * @param palette: The matrices to store to. It must hold Size() matrices.
+		 */
+		void ToMatrices(Matrix44* palette) const
+		{
+			const size_t size = Size();
+			for (size_t i = 0; i < size; i += PacketType::Lanes)
+			{
+				const RotationPacket rotation = LoadRotations(rotations, i);
+				const VectorPacket translation = LoadVectors(translations, i);
+				const VectorPacket scale = LoadVectors(scales, i);
+
+				const PacketType xx = rotation.x * rotation.x, yy = rotation.y * rotation.y, zz = rotation.z * rotation.z;
+				const PacketType xy = rotation.x * rotation.y, xz = rotation.x * rotation.z, yz = rotation.y * rotation.z;
+				const PacketType wx = rotation.w * rotation.x, wy = rotation.w * rotation.y, wz = rotation.w * rotation.z;
+				const PacketType one(1.0f), two(2.0f), zero(0.0f);
+
+				const Matrix44Packet<PacketType> matrices(
+					Vector4Packet<PacketType>((one - two * (yy + zz)) * scale.x, two * (xy - wz) * scale.y, two * (xz + wy) * scale.z, translation.x),
+					Vector4Packet<PacketType>(two * (xy + wz) * scale.x, (one - two * (xx + zz)) * scale.y, two * (yz - wx) * scale.z, translation.y),
+					Vector4Packet<PacketType>(two * (xz - wy) * scale.x, two * (yz + wx) * scale.y, (one - two * (xx + yy)) * scale.z, translation.z),
+					Vector4Packet<PacketType>(zero, zero, zero, one));
+
+				if (i + PacketType::Lanes <= size)
+					matrices.Store(palette + i);
+
+				else
+				{
+					Matrix44 tail[PacketType::Lanes];
+					matrices.Store(tail);
+					std::copy(tail, tail + (size - i), palette + i);
+				}
+			}
+		}
+
+	private:
+		/**
+		 * Load the rotations of PacketType::Lanes joints.
+		 *
+		 * @param stream: The rotation stream.
+		 * @param index: The first joint.
+		 * @return The rotation packet.
+		 */
+		static RotationPacket LoadRotations(const Vector4Stream& stream, size_t index)
+		{
+			return RotationPacket(
+				PacketType::LoadAligned(stream.X() + index),
+				PacketType::LoadAligned(stream.Y() + index),
+				PacketType::LoadAligned(stream.Z() + index),
+				PacketType::LoadAligned(stream.W() + index));
+		}
+
+		/**
+		 * Store the rotations of PacketType::Lanes joints.
+		 *
+		 * @param stream: The rotation stream.
+		 * @param index: The first joint.
+		 * @param packet: The rotation packet.
+		 */
+		static void StoreRotations(Vector4Stream& stream, size_t index, const RotationPacket& packet)
+		{
+			packet.x.StoreAligned(stream.X() + index);
+			packet.y.StoreAligned(stream.Y() + index);
+			packet.z.StoreAligned(stream.Z() + index);
+			packet.w.StoreAligned(stream.W() + index);
+		}
+
+		/**
+		 * Load the translations or scales of PacketType::Lanes joints.
+		 *
+		 * @param stream: The translation or scale stream.
+		 * @param index: The first joint.
+		 * @return The vector packet.
+		 */
+		static VectorPacket LoadVectors(const Vector3Stream& stream, size_t index)
+		{
+			return VectorPacket(
+				PacketType::LoadAligned(stream.X() + index),
+				PacketType::LoadAligned(stream.Y() + index),
+				PacketType::LoadAligned(stream.Z() + index));
+		}
+
+		/**
+		 * Store the translations or scales of PacketType::Lanes joints.
+		 *
+		 * @param stream: The translation or scale stream.
+		 * @param index: The first joint.
+		 * @param packet: The vector packet.
+		 */
+		static void StoreVectors(Vector3Stream& stream, size_t index, const VectorPacket& packet)
+		{
+			packet.x.StoreAligned(stream.X() + index);
+			packet.y.StoreAligned(stream.Y() + index);
+			packet.z.StoreAligned(stream.Z() + index);
+		}
+
+		/**
+		 * Load the factors of PacketType::Lanes joints. The lanes past the last joint are 0.
+		 *
+		 * @param factors: The factors.
+		 * @param index: The first joint.
+		 * @param size: The number of factors.
+		 * @return The factor packet.
+		 */
+		static PacketType LoadFactors(const float* factors, size_t index, size_t size)
+		{
+			if (index + PacketType::Lanes <= size)
+				return PacketType(factors + index);
+
+			alignas(64) float tail[PacketType::Lanes] = {};
+			if (index < size)
+				std::copy(factors + index, factors + size, tail);
+
+			return PacketType::LoadAligned(tail);
+		}
+
+		/**
+		 * Get the sign which moves a rotation into the hemisphere of another, so that the blend takes the shortest path.
+		 *
+		 * @param cosine: The dot products of the rotations.
+		 * @return 1 or -1 per lane.
+		 */
+		static PacketType HemisphereSign(const PacketType& cosine)
+		{
+			return Select(cosine.Less(PacketType(0.0f)), PacketType(-1.0f), PacketType(1.0f));
+		}
+
+		/**
+		 * Blend two rotation packets along the shortest path.
+		 *
+		 * @param from: The rotations at factor 0.
+		 * @param to: The rotations at factor 1.
+		 * @param factor: The blend factors.
+		 * @param method: The rotation blend method.
+		 * @return The blended unit rotations.
+		 */
+		static RotationPacket BlendRotations(const RotationPacket& from, const RotationPacket& to, PacketType factor, RotationBlend method)
+		{
+			const PacketType cosine = from.Dot(to);
+			const PacketType sign = HemisphereSign(cosine);
+
+			if (method == RotationBlend::FastSlerp)
+			{
+				// Nlerp factor correction, fitted to slerp over the cosine of the angle (d) and the factor (t):
+				// t' = t + t (t - 0.5) (t - 1) (A (t - 0.5)^2 + B).
+				const PacketType d = cosine.Abs();
+				const PacketType a = d.MulAdd(d.MulAdd(d.MulAdd(PacketType(-1.43519f), PacketType(3.55645f)), PacketType(-3.2452f)), PacketType(1.0904f));
+				const PacketType b = d.MulAdd(d.MulAdd(PacketType(0.215638f), PacketType(-1.06021f)), PacketType(0.848013f));
+				const PacketType centered = factor - 0.5f;
+				const PacketType k = a.MulAdd(centered * centered, b);
+
+				factor = (factor * centered * (factor - 1.0f)).MulAdd(k, factor);
+			}
+
+			return (to * sign - from).MulAdd(factor, from).Normalize();
+		}
+
+		/**
+		 * Blend the joints of one packet.
+		 *
+		 * @param from: The pose at factor 0.
+		 * @param to: The pose at factor 1.
+		 * @param factor: The blend factors.
+		 * @param result: The blended pose.
+		 * @param index: The first joint.
+		 * @param method: The rotation blend method.
+		 */
+		static void BlendPacket(const Pose& from, const Pose& to, PacketType factor, Pose& result, size_t index, RotationBlend method)
+		{
+			const VectorPacket fromTranslation = LoadVectors(from.translations, index);
+			const VectorPacket fromScale = LoadVectors(from.scales, index);
+
+			StoreRotations(result.rotations, index, BlendRotations(LoadRotations(from.rotations, index), LoadRotations(to.rotations, index), factor, method));
+			StoreVectors(result.translations, index, (LoadVectors(to.translations, index) - fromTranslation).MulAdd(factor, fromTranslation));
+			StoreVectors(result.scales, index, (LoadVectors(to.scales, index) - fromScale).MulAdd(factor, fromScale));
+		}
+
+		/**
+		 * Multiply two rotation packets (the Hamilton product, per lane).
+		 *
+		 * @param lhs: The LHS rotations.
+		 * @param rhs: The RHS rotations.
+		 * @return The products.
+		 */
+		static RotationPacket Multiply(const RotationPacket& lhs, const RotationPacket& rhs)
+		{
+			return RotationPacket(
+				lhs.w.MulAdd(rhs.x, lhs.x.MulAdd(rhs.w, lhs.y.MulAdd(rhs.z, -(lhs.z * rhs.y)))),
+				lhs.w.MulAdd(rhs.y, lhs.y.MulAdd(rhs.w, lhs.z.MulAdd(rhs.x, -(lhs.x * rhs.z)))),
+				lhs.w.MulAdd(rhs.z, lhs.z.MulAdd(rhs.w, lhs.x.MulAdd(rhs.y, -(lhs.y * rhs.x)))),
+				lhs.w.MulAdd(rhs.w, -lhs.x.MulAdd(rhs.x, lhs.y.MulAdd(rhs.y, lhs.z * rhs.z))));
+		}
+
+	private:
+		Vector4Stream rotations;
+		Vector3Stream translations;
+		Vector3Stream scales;
+	};
+}
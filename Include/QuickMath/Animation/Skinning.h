@@ -0,0 +1,362 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "../Matrix/Transform3x4.h"
+#include "../Quaternion/DualQuaternion.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace QuickMath
+{
+	/**
+	 * Batch skinning kernels.
+	 * These deform arrays of positions (and optionally normals) by a joint palette, with a fixed number of weighted influences per vertex.
+	 * The influences of a vertex are blended into one transform in registers, which is then applied to the position and the normal:
+	 * one 4 lane multiply-add per matrix row on SSE, a 256 bit row pair on AVX and the whole matrix in one 512 bit register on AVX-512.
+	 */
+	namespace Skinning
+	{
+		/**
+		 * The joint influences of a vertex.
+		 * Unused influences should have a weight of 0 and a valid joint index (such as 0). The weights should add up to 1.
+		 *
+		 * @tparam Count: The number of influences.
+		 */
+		template<unsigned int Count>
+		struct Influences
+		{
+			unsigned int joints[Count];
+			float weights[Count];
+		};
+
+		/**
+		 * 4 influences per vertex.
+		 */
+		typedef Influences<4> Influences4;
+
+		/**
+		 * 8 influences per vertex.
+		 */
+		typedef Influences<8> Influences8;
+
+		/**
+		 * Blend the palette matrices of a vertex (linear blend skinning).
+		 * The fourth rows are not blended, since skinning matrices are affine.
+		 *
+		 * @param palette: The joint matrices.
+		 * @param influences: The influences of the vertex.
+		 * @return The blended transform.
+		 */
+		template<unsigned int Count>
+		inline Transform3x4 BlendInfluences(const Matrix44* palette, const Influences<Count>& influences)
+		{
+			const float* first = reinterpret_cast<const float*>(palette + influences.joints[0]);
+
+#if SSE_INSTR_SET > 8
+			__m512 rows = _mm512_mul_ps(_mm512_loadu_ps(first), _mm512_set1_ps(influences.weights[0]));
+			for (unsigned int i = 1; i < Count; i++)
+				rows = Intrinsics::MulAdd(_mm512_loadu_ps(reinterpret_cast<const float*>(palette + influences.joints[i])), _mm512_set1_ps(influences.weights[i]), rows);
+
+			return Transform3x4(_mm512_castps512_ps128(rows), _mm512_extractf32x4_ps(rows, 1), _mm512_extractf32x4_ps(rows, 2));
+
+#elif SSE_INSTR_SET > 6
+			__m256 rows = _mm256_mul_ps(_mm256_loadu_ps(first), _mm256_set1_ps(influences.weights[0]));
+			__m128 row2 = _mm_mul_ps(_mm_loadu_ps(first + 8), _mm_set1_ps(influences.weights[0]));
+			for (unsigned int i = 1; i < Count; i++)
+			{
+				const float* matrix = reinterpret_cast<const float*>(palette + influences.joints[i]);
+				rows = Intrinsics::MulAdd(_mm256_loadu_ps(matrix), _mm256_set1_ps(influences.weights[i]), rows);
+				row2 = Intrinsics::MulAdd(_mm_loadu_ps(matrix + 8), _mm_set1_ps(influences.weights[i]), row2);
+			}
+
+			return Transform3x4(_mm256_castps256_ps128(rows), _mm256_extractf128_ps(rows, 1), row2);
+
+#else
+			const __m128 firstWeight = _mm_set1_ps(influences.weights[0]);
+			__m128 row0 = _mm_mul_ps(_mm_loadu_ps(first), firstWeight);
+			__m128 row1 = _mm_mul_ps(_mm_loadu_ps(first + 4), firstWeight);
+			__m128 row2 = _mm_mul_ps(_mm_loadu_ps(first + 8), firstWeight);
+			for (unsigned int i = 1; i < Count; i++)
+			{
+				const float* matrix = reinterpret_cast<const float*>(palette + influences.joints[i]);
+				const __m128 weight = _mm_set1_ps(influences.weights[i]);
+				row0 = Intrinsics::MulAdd(_mm_loadu_ps(matrix), weight, row0);
+				row1 = Intrinsics::MulAdd(_mm_loadu_ps(matrix + 4), weight, row1);
+				row2 = Intrinsics::MulAdd(_mm_loadu_ps(matrix + 8), weight, row2);
+			}
+
+			return Transform3x4(row0, row1, row2);
+
+#endif // SSE_INSTR_SET > 8
+		}
+
+		/**
+		 * Blend the palette dual quaternions of a vertex (dual quaternion skinning).
+		 * Each influence is flipped to the hemisphere of the first one, so that the blend takes the shortest path.
+		 *
+		 * @param palette: The joint dual quaternions.
+		 * @param influences: The influences of the vertex.
+		 * @return The blended and normalized dual quaternion.
+		 */
+		template<unsigned int Count>
+		inline DualQuaternion BlendInfluences(const DualQuaternion* palette, const Influences<Count>& influences)
+		{
+			const float* first = reinterpret_cast<const float*>(palette + influences.joints[0]);
+			const __m128 pivot = _mm_loadu_ps(first);
+
+#if SSE_INSTR_SET > 6
+			__m256 parts = _mm256_mul_ps(_mm256_loadu_ps(first), _mm256_set1_ps(influences.weights[0]));
+			for (unsigned int i = 1; i < Count; i++)
+			{
+				const float* dualQuaternion = reinterpret_cast<const float*>(palette + influences.joints[i]);
+				const __m128 sign = _mm_and_ps(Intrinsics::Dot4(pivot, _mm_loadu_ps(dualQuaternion)), _mm_set1_ps(-0.0f));
+				const __m128 weight = _mm_xor_ps(_mm_set1_ps(influences.weights[i]), sign);
+
+				parts = Intrinsics::MulAdd(_mm256_loadu_ps(dualQuaternion), _mm256_insertf128_ps(_mm256_castps128_ps256(weight), weight, 1), parts);
+			}
+
+			const DualQuaternion blended(Quaternion(_mm256_castps256_ps128(parts)), Quaternion(_mm256_extractf128_ps(parts, 1)));
+
+#else
+			const __m128 firstWeight = _mm_set1_ps(influences.weights[0]);
+			__m128 real = _mm_mul_ps(pivot, firstWeight);
+			__m128 dual = _mm_mul_ps(_mm_loadu_ps(first + 4), firstWeight);
+			for (unsigned int i = 1; i < Count; i++)
+			{
+				const float* dualQuaternion = reinterpret_cast<const float*>(palette + influences.joints[i]);
+				const __m128 otherReal = _mm_loadu_ps(dualQuaternion);
+				const __m128 sign = _mm_and_ps(Intrinsics::Dot4(pivot, otherReal), _mm_set1_ps(-0.0f));
+				const __m128 weight = _mm_xor_ps(_mm_set1_ps(influences.weights[i]), sign);
+
+				real = Intrinsics::MulAdd(otherReal, weight, real);
+				dual = Intrinsics::MulAdd(_mm_loadu_ps(dualQuaternion + 4), weight, dual);
+			}
+
+			const DualQuaternion blended((Quaternion(real)), Quaternion(dual));
+
+#endif // SSE_INSTR_SET > 6
+
+			return blended.Normalize();
+		}
+
+		/**
+		 * Transform a normal by a blended matrix. The result is renormalized, since a blend of rotations is not a rotation.
+		 *
+		 * @param transform: The blended transform.
+		 * @param normal: The normal.
+		 * @return The skinned normal.
+		 */
+		inline Vector3 SkinNormal(const Transform3x4& transform, const Vector3& normal)
+		{
+			return transform.TransformVector(normal).Normalize();
+		}
+
+		/**
+		 * Transform a normal by a blended dual quaternion. A normalized dual quaternion is a pure rotation, so the length is kept.
+		 *
+		 * @param transform: The blended dual quaternion.
+		 * @param normal: The normal.
+		 * @return The skinned normal.
+		 */
+		inline Vector3 SkinNormal(const DualQuaternion& transform, const Vector3& normal)
+		{
+			return transform.TransformVector(normal);
+		}
+
+		/**
+		 * The skinning loop.
+		 *
+		 * @tparam Mode: The store mode.
+		 * @param palette: The joint palette (Matrix44 or DualQuaternion).
+		 * @param influences: The influences, one per vertex.
+		 * @param positions: The input positions.
+		 * @param normals: The input normals. Can be nullptr.
+		 * @param skinnedPositions: The output positions.
+		 * @param skinnedNormals: The output normals. Can be nullptr when normals is.
+		 * @param count: The number of vertices.
+		 */
+		template<StoreMode Mode, class Palette, unsigned int Count>
+		inline void SkinLoop(const Palette* palette, const Influences<Count>* influences, const Vector3* positions, const Vector3* normals,
+			Vector3* skinnedPositions, Vector3* skinnedNormals, size_t count)
+		{
+			for (size_t index = 0; index < count; index++)
+			{
+				if (index + 8 < count)
+					_mm_prefetch(reinterpret_cast<const char*>(influences + index + 8), _MM_HINT_T0);
+
+				const auto transform = BlendInfluences(palette, influences[index]);
+				Intrinsics::Store<Mode>(reinterpret_cast<float*>(skinnedPositions + index), transform.TransformPoint(positions[index]).intrinsic);
+
+				if (normals)
+					Intrinsics::Store<Mode>(reinterpret_cast<float*>(skinnedNormals + index), SkinNormal(transform, normals[index]).intrinsic);
+			}
+		}
+
+		/**
+		 * Skin the vertices on the calling thread.
+		 *
+		 * @param palette: The joint palette (Matrix44 or DualQuaternion).
+		 * @param influences: The influences, one per vertex.
+		 * @param positions: The input positions.
+		 * @param normals: The input normals. Can be nullptr.
+		 * @param skinnedPositions: The output positions.
+		 * @param skinnedNormals: The output normals. Can be nullptr when normals is.
+		 * @param count: The number of vertices.
+		 * @param mode: The store mode.
+		 */
+		template<class Palette, unsigned int Count>
+		inline void Skin(const Palette* palette, const Influences<Count>* influences, const Vector3* positions, const Vector3* normals,
+			Vector3* skinnedPositions, Vector3* skinnedNormals, size_t count, StoreMode mode)
+		{
+			if (mode == StoreMode::NonTemporal)
+			{
+				SkinLoop<StoreMode::NonTemporal>(palette, influences, positions, normals, skinnedPositions, skinnedNormals, count);
+				_mm_sfence();
+			}
+			else
+				SkinLoop<StoreMode::Cached>(palette, influences, positions, normals, skinnedPositions, skinnedNormals, count);
+		}
+
+		/**
+		 * Skin the vertices on a number of threads, each one taking a contiguous vertex range. The calling thread takes the last range.
+		 *
+		 * @param palette: The joint palette (Matrix44 or DualQuaternion).
+		 * @param influences: The influences, one per vertex.
+		 * @param positions: The input positions.
+		 * @param normals: The input normals. Can be nullptr.
+		 * @param skinnedPositions: The output positions.
+		 * @param skinnedNormals: The output normals. Can be nullptr when normals is.
+		 * @param count: The number of vertices.
+		 * @param threadCount: The number of threads. 0 uses std::thread::hardware_concurrency.
+		 * @param mode: The store mode.
+		 */
+		template<class Palette, unsigned int Count>
+		inline void SkinParallel(const Palette* palette, const Influences<Count>* influences, const Vector3* positions, const Vector3* normals,
+			Vector3* skinnedPositions, Vector3* skinnedNormals, size_t count, unsigned int threadCount, StoreMode mode)
+		{
+			if (threadCount == 0)
+				threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+			// The ranges hold whole 64 byte lines of positions (four vertices), and the range boundaries are moved to line boundaries of
+			// the actual position output, so that the threads do not share lines. The first range takes the vertices before the first
+			// line boundary.
+			const size_t rangeSize = std::max<size_t>(((count + threadCount - 1) / threadCount + 3) & ~size_t(3), 4);
+			const size_t leading = (uintptr_t(0) - reinterpret_cast<uintptr_t>(skinnedPositions)) % 64 / sizeof(Vector3);
+
+			std::vector<std::thread> threads;
+			size_t first = 0;
+			try
+			{
+				for (size_t last = leading + rangeSize; last < count; first = last, last += rangeSize)
+				{
+					threads.emplace_back([=]
+						{
+							Skin(palette, influences + first, positions + first, normals ? normals + first : nullptr,
+								skinnedPositions + first, skinnedNormals ? skinnedNormals + first : nullptr, last - first, mode);
+						});
+				}
+			}
+			catch (...)
+			{
+				// A thread could not be started. Wait for the ones which were, since a joinable std::thread must not be destroyed.
+				for (auto& thread : threads)
+					thread.join();
+
+				throw;
+			}
+
+			Skin(palette, influences + first, positions + first, normals ? normals + first : nullptr,
+				skinnedPositions + first, skinnedNormals ? skinnedNormals + first : nullptr, count - first, mode);
+
+			for (auto& thread : threads)
+				thread.join();
+		}
+
+		/**
+		 * Linear blend skinning.
+		 * The output may be the same arrays as the input.
+		 *
+		 * @param palette: The joint matrices (Matrix44 * Vector4 convention, with an affine fourth row).
+		 * @param influences: The influences, one per vertex.
+		 * @param positions: The input positions.
+		 * @param normals: The input normals. Can be nullptr, to skin the positions only.
+		 * @param skinnedPositions: The output positions.
+		 * @param skinnedNormals: The output normals, renormalized. Can be nullptr when normals is.
+		 * @param count: The number of vertices.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		template<unsigned int Count>
+		inline void LinearBlend(const Matrix44* palette, const Influences<Count>* influences, const Vector3* positions, const Vector3* normals,
+			Vector3* skinnedPositions, Vector3* skinnedNormals, size_t count, StoreMode mode = StoreMode::Cached)
+		{
+			Skin(palette, influences, positions, normals, skinnedPositions, skinnedNormals, count, mode);
+		}
+
+		/**
+		 * Linear blend skinning on a number of threads, split by vertex range.
+		 * The output may be the same arrays as the input.
+		 *
+		 * @param palette: The joint matrices (Matrix44 * Vector4 convention, with an affine fourth row).
+		 * @param influences: The influences, one per vertex.
+		 * @param positions: The input positions.
+		 * @param normals: The input normals. Can be nullptr, to skin the positions only.
+		 * @param skinnedPositions: The output positions.
+		 * @param skinnedNormals: The output normals, renormalized. Can be nullptr when normals is.
+		 * @param count: The number of vertices.
+		 * @param threadCount: The number of threads. Default is 0, which uses std::thread::hardware_concurrency.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		template<unsigned int Count>
+		inline void LinearBlendParallel(const Matrix44* palette, const Influences<Count>* influences, const Vector3* positions, const Vector3* normals,
+			Vector3* skinnedPositions, Vector3* skinnedNormals, size_t count, unsigned int threadCount = 0, StoreMode mode = StoreMode::Cached)
+		{
+			SkinParallel(palette, influences, positions, normals, skinnedPositions, skinnedNormals, count, threadCount, mode);
+		}
+
+		/**
+		 * Dual quaternion skinning.
+		 * This keeps the volume around twisting joints, where linear blend skinning collapses, but the palette cannot hold scale.
+		 * The output may be the same arrays as the input.
+		 *
+		 * @param palette: The joint dual quaternions (for example DualQuaternion(matrix) for each rigid joint matrix).
+		 * @param influences: The influences, one per vertex.
+		 * @param positions: The input positions.
+		 * @param normals: The input normals. Can be nullptr, to skin the positions only.
+		 * @param skinnedPositions: The output positions.
+		 * @param skinnedNormals: The output normals. Can be nullptr when normals is.
+		 * @param count: The number of vertices.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		template<unsigned int Count>
+		inline void DualQuaternionBlend(const DualQuaternion* palette, const Influences<Count>* influences, const Vector3* positions, const Vector3* normals,
+			Vector3* skinnedPositions, Vector3* skinnedNormals, size_t count, StoreMode mode = StoreMode::Cached)
+		{
+			Skin(palette, influences, positions, normals, skinnedPositions, skinnedNormals, count, mode);
+		}
+
+		/**
+		 * Dual quaternion skinning on a number of threads, split by vertex range.
+		 * The output may be the same arrays as the input.
+		 *
+		 * @param palette: The joint dual quaternions.
+		 * @param influences: The influences, one per vertex.
+		 * @param positions: The input positions.
+		 * @param normals: The input normals. Can be nullptr, to skin the positions only.
+		 * @param skinnedPositions: The output positions.
+		 * @param skinnedNormals: The output normals. Can be nullptr when normals is.
+		 * @param count: The number of vertices.
+		 * @param threadCount: The number of threads. Default is 0, which uses std::thread::hardware_concurrency.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		template<unsigned int Count>
+		inline void DualQuaternionBlendParallel(const DualQuaternion* palette, const Influences<Count>* influences, const Vector3* positions, const Vector3* normals,
+			Vector3* skinnedPositions, Vector3* skinnedNormals, size_t count, unsigned int threadCount = 0, StoreMode mode = StoreMode::Cached)
+		{
+			SkinParallel(palette, influences, positions, normals, skinnedPositions, skinnedNormals, count, threadCount, mode);
+		}
+	}
+}
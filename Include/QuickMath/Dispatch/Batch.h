@@ -0,0 +1,161 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Kernels.h"
+#include "../Matrix/Matrix33.h"
+#include "../Matrix/Matrix44.h"
+#include "../Vector/Vector3.h"
+
+namespace QuickMath
+{
+	/**
+	 * Batch entry points.
+	 * These process whole arrays, and run the kernels of the highest instruction tier the CPU supports, whatever SSE_INSTR_SET the
+	 * including code is compiled with. The CPU is queried once, on the first call, and the choice is cached in a function pointer table.
+	 */
+	namespace Batch
+	{
+		/**
+		 * Batch kernel table.
+		 * This holds the kernels of one instruction tier.
+		 */
+		struct KernelTable
+		{
+			Kernels::TransformKernel Transform = nullptr;
+			Kernels::NormalizeKernel Normalize = nullptr;
+			Kernels::DotKernel Dot = nullptr;
+
+			InstructionTier Tier = InstructionTier::SSE2;
+		};
+
+		/**
+		 * Create the kernel table of an instruction tier.
+		 *
+		 * @param tier: The instruction tier.
+		 * @return The kernel table.
+		 */
+		inline KernelTable CreateKernelTable(InstructionTier tier)
+		{
+			KernelTable table;
+			table.Tier = tier;
+
+			switch (tier)
+			{
+			case InstructionTier::AVX512:
+				table.Transform = Kernels::AVX512::Transform;
+				table.Normalize = Kernels::AVX512::Normalize;
+				table.Dot = Kernels::AVX512::Dot;
+				break;
+
+			case InstructionTier::AVX2:
+				table.Transform = Kernels::AVX2::Transform;
+				table.Normalize = Kernels::AVX2::Normalize;
+				table.Dot = Kernels::AVX2::Dot;
+				break;
+
+			case InstructionTier::SSE41:
+				table.Transform = Kernels::SSE2::Transform;	// SSE4.1 adds nothing to the transform.
+				table.Normalize = Kernels::SSE41::Normalize;
+				table.Dot = Kernels::SSE41::Dot;
+				break;
+
+			default:
+				table.Transform = Kernels::SSE2::Transform;
+				table.Normalize = Kernels::SSE2::Normalize;
+				table.Dot = Kernels::SSE2::Dot;
+				break;
+			}
+
+			return table;
+		}
+
+		/**
+		 * Get the kernel table of the detected instruction tier.
+		 * The table is created on the first call (thread safe) and reused afterwards.
+		 *
+		 * @return The kernel table.
+		 */
+		inline const KernelTable& GetKernelTable()
+		{
+			static const KernelTable table = CreateKernelTable(CPU::DetectInstructionTier());
+			return table;
+		}
+
+		/**
+		 * Get the instruction tier the batch kernels run with.
+		 *
+		 * @return The instruction tier.
+		 */
+		inline InstructionTier GetSelectedTier()
+		{
+			return GetKernelTable().Tier;
+		}
+
+		/**
+		 * Transform an array of vectors by a matrix (the same as matrix * input[i]).
+		 * The output may be the same array as the input.
+		 *
+		 * @param matrix: The matrix.
+		 * @param input: The input vectors.
+		 * @param output: The output vectors.
+		 * @param count: The number of vectors.
+		 */
+		inline void Transform(const Matrix44& matrix, const Vector4* input, Vector4* output, size_t count)
+		{
+			GetKernelTable().Transform(&matrix.r.x, &input->x, &output->x, count);
+		}
+
+		/**
+		 * Normalize an array of vectors.
+		 * The output may be the same array as the input.
+		 *
+		 * @param input: The input vectors.
+		 * @param output: The normalized vectors.
+		 * @param count: The number of vectors.
+		 */
+		inline void Normalize(const Vector4* input, Vector4* output, size_t count)
+		{
+			GetKernelTable().Normalize(&input->x, &output->x, count, 4);
+		}
+
+		/**
+		 * Normalize an array of vectors. The w lanes are ignored.
+		 * The output may be the same array as the input.
+		 *
+		 * @param input: The input vectors.
+		 * @param output: The normalized vectors.
+		 * @param count: The number of vectors.
+		 */
+		inline void Normalize(const Vector3* input, Vector3* output, size_t count)
+		{
+			GetKernelTable().Normalize(&input->x, &output->x, count, 3);
+		}
+
+		/**
+		 * Compute the dot products of two arrays of vectors (output[i] = lhs[i].Dot(rhs[i])).
+		 *
+		 * @param lhs: The LHS vectors.
+		 * @param rhs: The RHS vectors.
+		 * @param output: The dot products.
+		 * @param count: The number of vectors.
+		 */
+		inline void Dot(const Vector4* lhs, const Vector4* rhs, float* output, size_t count)
+		{
+			GetKernelTable().Dot(&lhs->x, &rhs->x, output, count, 4);
+		}
+
+		/**
+		 * Compute the dot products of two arrays of vectors (output[i] = lhs[i].Dot(rhs[i])). The w lanes are ignored.
+		 *
+		 * @param lhs: The LHS vectors.
+		 * @param rhs: The RHS vectors.
+		 * @param output: The dot products.
+		 * @param count: The number of vectors.
+		 */
+		inline void Dot(const Vector3* lhs, const Vector3* rhs, float* output, size_t count)
+		{
+			GetKernelTable().Dot(&lhs->x, &rhs->x, output, count, 3);
+		}
+	}
+}
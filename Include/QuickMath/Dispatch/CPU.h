@@ -0,0 +1,143 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "../IncludeSIMD.h"
+
+// The dispatched kernels use instruction sets above the compile time SSE_INSTR_SET, so the full intrinsic header is needed.
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#   include <intrin.h>
+#   define QUICKMATH_TARGET(instructionSets)
+
+#else
+#   include <cpuid.h>
+#   define QUICKMATH_TARGET(instructionSets) __attribute__((target(instructionSets)))
+
+#endif // _MSC_VER
+
+namespace QuickMath
+{
+	/**
+	 * Instruction set tiers the batch kernels are compiled for.
+	 * The tiers are ordered, so a tier can be compared with another.
+	 */
+	enum class InstructionTier : unsigned char
+	{
+		SSE2,
+		SSE41,
+		AVX2,	// AVX2 and FMA3.
+		AVX512	// AVX-512F.
+	};
+
+	namespace CPU
+	{
+		/**
+		 * Run the cpuid instruction.
+		 *
+		 * @param leaf: The leaf (eax) to query.
+		 * @param subLeaf: The sub leaf (ecx) to query.
+		 * @param registers: The eax, ebx, ecx and edx results.
+		 */
+		inline void CPUID(unsigned int leaf, unsigned int subLeaf, unsigned int registers[4])
+		{
+#ifdef _MSC_VER
+			int results[4] = {};
+			__cpuidex(results, static_cast<int>(leaf), static_cast<int>(subLeaf));
+			for (int i = 0; i < 4; i++)
+				registers[i] = static_cast<unsigned int>(results[i]);
+
+#else
+			registers[0] = registers[1] = registers[2] = registers[3] = 0;
+			__get_cpuid_count(leaf, subLeaf, &registers[0], &registers[1], &registers[2], &registers[3]);
+
+#endif // _MSC_VER
+		}
+
+		/**
+		 * Get the register state the operating system saves on a context switch (XCR0).
+		 * This must only be called when cpuid reports OSXSAVE.
+		 *
+		 * @return The XCR0 value.
+		 */
+		inline unsigned long long ExtendedControlRegister()
+		{
+#ifdef _MSC_VER
+			return _xgetbv(0);
+
+#else
+			unsigned int low = 0, high = 0;
+			__asm__ __volatile__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+			return (static_cast<unsigned long long>(high) << 32) | low;
+
+#endif // _MSC_VER
+		}
+
+		/**
+		 * Detect the highest instruction tier the CPU and the operating system support.
+		 * The AVX tiers also require the operating system to save the wider registers.
+		 *
+		 * @return The instruction tier.
+		 */
+		inline InstructionTier DetectInstructionTier()
+		{
+			unsigned int leaf1[4] = {}, leaf7[4] = {};
+			CPUID(0, 0, leaf1);
+			const unsigned int maximumLeaf = leaf1[0];
+
+			CPUID(1, 0, leaf1);
+			if (maximumLeaf >= 7)
+				CPUID(7, 0, leaf7);
+
+			const bool sse41 = (leaf1[2] & (1u << 19)) != 0;
+			const bool osxsave = (leaf1[2] & (1u << 27)) != 0;
+			const bool avx = (leaf1[2] & (1u << 28)) != 0;
+			const bool fma = (leaf1[2] & (1u << 12)) != 0;
+			const bool avx2 = (leaf7[1] & (1u << 5)) != 0;
+			const bool avx512f = (leaf7[1] & (1u << 16)) != 0;
+
+			const unsigned long long xcr0 = osxsave ? ExtendedControlRegister() : 0;
+			const bool avxState = (xcr0 & 0x06) == 0x06;			// XMM and YMM.
+			const bool avx512State = (xcr0 & 0xE6) == 0xE6;		// XMM, YMM, opmask and ZMM.
+
+			if (avx512f && avx512State)
+				return InstructionTier::AVX512;
+
+			if (avx && avx2 && fma && avxState)
+				return InstructionTier::AVX2;
+
+			if (sse41)
+				return InstructionTier::SSE41;
+
+			return InstructionTier::SSE2;
+		}
+
+		/**
+		 * Get the name of an instruction tier.
+		 *
+		 * @param tier: The instruction tier.
+		 * @return The name string.
+		 */
+		inline const char* GetInstructionTierName(InstructionTier tier)
+		{
+			switch (tier)
+			{
+			case InstructionTier::SSE2:
+				return "SSE2";
+
+			case InstructionTier::SSE41:
+				return "SSE4.1";
+
+			case InstructionTier::AVX2:
+				return "AVX2";
+
+			case InstructionTier::AVX512:
+				return "AVX-512";
+
+			default:
+				return "Unknown";
+			}
+		}
+	}
+}
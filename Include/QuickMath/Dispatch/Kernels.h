@@ -0,0 +1,453 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "CPU.h"
+
+#include <cstddef>
+
+namespace QuickMath
+{
+	/**
+	 * Batch kernels, one set per instruction tier.
+	 * Every kernel is compiled for its own tier (QUICKMATH_TARGET), independent of SSE_INSTR_SET, and is selected at run time by Batch.h.
+	 * The kernels only use raw intrinsics, since the shared helpers are compiled for SSE_INSTR_SET and cannot be inlined into a wider target.
+	 *
+	 * The arrays hold 4 floats per element (Vector3 and Vector4 are both 16 bytes). The matrix is 16 floats, row after row.
+	 * The lanes argument is 3 for Vector3 (the w lane is ignored) and 4 for Vector4.
+	 */
+	namespace Kernels
+	{
+		/**
+		 * Kernel to transform vectors by a matrix (result[i] = dot(row i, vector)).
+		 */
+		typedef void(*TransformKernel)(const float* matrix, const float* input, float* output, size_t count);
+
+		/**
+		 * Kernel to normalize vectors.
+		 */
+		typedef void(*NormalizeKernel)(const float* input, float* output, size_t count, int lanes);
+
+		/**
+		 * Kernel to compute the dot products of two vector arrays.
+		 */
+		typedef void(*DotKernel)(const float* lhs, const float* rhs, float* output, size_t count, int lanes);
+
+		/**
+		 * SSE2 kernels. These are the baseline every x86-64 CPU supports.
+		 */
+		namespace SSE2
+		{
+			/**
+			 * Load the matrix columns, so that a vector is transformed with four multiply-adds.
+			 *
+			 * @param matrix: The matrix rows.
+			 * @param columns: The four columns.
+			 */
+			inline void LoadColumns(const float* matrix, __m128 columns[4])
+			{
+				columns[0] = _mm_loadu_ps(matrix);
+				columns[1] = _mm_loadu_ps(matrix + 4);
+				columns[2] = _mm_loadu_ps(matrix + 8);
+				columns[3] = _mm_loadu_ps(matrix + 12);
+				_MM_TRANSPOSE4_PS(columns[0], columns[1], columns[2], columns[3]);
+			}
+
+			/**
+			 * Get the lane mask which keeps the used lanes of a product.
+			 *
+			 * @param lanes: The number of lanes (3 or 4).
+			 * @return The lane mask.
+			 */
+			inline __m128 LaneMask(int lanes)
+			{
+				return _mm_castsi128_ps(_mm_set_epi32(lanes == 4 ? -1 : 0, -1, -1, -1));
+			}
+
+			/**
+			 * Sum the lanes of a product.
+			 *
+			 * @param product: The product.
+			 * @return The sum, splatted to all four lanes.
+			 */
+			inline __m128 Sum(__m128 product)
+			{
+				const __m128 sum = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+				return _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+			}
+
+			/**
+			 * Transform vectors by a matrix.
+			 *
+			 * @param matrix: The matrix rows.
+			 * @param input: The input vectors.
+			 * @param output: The transformed vectors.
+			 * @param count: The number of vectors.
+			 */
+			inline void Transform(const float* matrix, const float* input, float* output, size_t count)
+			{
+				__m128 columns[4];
+				LoadColumns(matrix, columns);
+
+				for (size_t i = 0; i < count; i++)
+				{
+					const __m128 vector = _mm_loadu_ps(input + i * 4);
+					__m128 result = _mm_mul_ps(columns[0], _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0)));
+					result = _mm_add_ps(result, _mm_mul_ps(columns[1], _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1))));
+					result = _mm_add_ps(result, _mm_mul_ps(columns[2], _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2))));
+					result = _mm_add_ps(result, _mm_mul_ps(columns[3], _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(3, 3, 3, 3))));
+					_mm_storeu_ps(output + i * 4, result);
+				}
+			}
+
+			/**
+			 * Normalize vectors.
+			 *
+			 * @param input: The input vectors.
+			 * @param output: The output vectors.
+			 * @param count: The number of vectors.
+			 * @param lanes: The number of lanes (3 or 4).
+			 */
+			inline void Normalize(const float* input, float* output, size_t count, int lanes)
+			{
+				const __m128 mask = LaneMask(lanes);
+				for (size_t i = 0; i < count; i++)
+				{
+					const __m128 vector = _mm_loadu_ps(input + i * 4);
+					const __m128 lengthSquared = Sum(_mm_and_ps(_mm_mul_ps(vector, vector), mask));
+					_mm_storeu_ps(output + i * 4, _mm_div_ps(vector, _mm_sqrt_ps(lengthSquared)));
+				}
+			}
+
+			/**
+			 * Compute the dot products of two vector arrays.
+			 *
+			 * @param lhs: The LHS vectors.
+			 * @param rhs: The RHS vectors.
+			 * @param output: The dot products.
+			 * @param count: The number of vectors.
+			 * @param lanes: The number of lanes (3 or 4).
+			 */
+			inline void Dot(const float* lhs, const float* rhs, float* output, size_t count, int lanes)
+			{
+				const __m128 mask = LaneMask(lanes);
+				for (size_t i = 0; i < count; i++)
+				{
+					const __m128 product = _mm_and_ps(_mm_mul_ps(_mm_loadu_ps(lhs + i * 4), _mm_loadu_ps(rhs + i * 4)), mask);
+					_mm_store_ss(output + i, Sum(product));
+				}
+			}
+		}
+
+		/**
+		 * SSE4.1 kernels. The horizontal sums use _mm_dp_ps.
+		 */
+		namespace SSE41
+		{
+			/**
+			 * Normalize vectors using a fixed dot product mask.
+			 *
+			 * @tparam DotMask: The _mm_dp_ps mask.
+			 * @param input: The input vectors.
+			 * @param output: The output vectors.
+			 * @param count: The number of vectors.
+			 */
+			template<int DotMask>
+			QUICKMATH_TARGET("sse4.1") void NormalizeLanes(const float* input, float* output, size_t count)
+			{
+				for (size_t i = 0; i < count; i++)
+				{
+					const __m128 vector = _mm_loadu_ps(input + i * 4);
+					_mm_storeu_ps(output + i * 4, _mm_div_ps(vector, _mm_sqrt_ps(_mm_dp_ps(vector, vector, DotMask))));
+				}
+			}
+
+			/**
+			 * Compute dot products using a fixed dot product mask.
+			 *
+			 * @tparam DotMask: The _mm_dp_ps mask.
+			 * @param lhs: The LHS vectors.
+			 * @param rhs: The RHS vectors.
+			 * @param output: The dot products.
+			 * @param count: The number of vectors.
+			 */
+			template<int DotMask>
+			QUICKMATH_TARGET("sse4.1") void DotLanes(const float* lhs, const float* rhs, float* output, size_t count)
+			{
+				for (size_t i = 0; i < count; i++)
+					_mm_store_ss(output + i, _mm_dp_ps(_mm_loadu_ps(lhs + i * 4), _mm_loadu_ps(rhs + i * 4), DotMask));
+			}
+
+			/**
+			 * Normalize vectors.
+			 *
+			 * @param input: The input vectors.
+			 * @param output: The output vectors.
+			 * @param count: The number of vectors.
+			 * @param lanes: The number of lanes (3 or 4).
+			 */
+			inline void Normalize(const float* input, float* output, size_t count, int lanes)
+			{
+				if (lanes == 4)
+					NormalizeLanes<0xFF>(input, output, count);
+				else
+					NormalizeLanes<0x7F>(input, output, count);
+			}
+
+			/**
+			 * Compute the dot products of two vector arrays.
+			 *
+			 * @param lhs: The LHS vectors.
+			 * @param rhs: The RHS vectors.
+			 * @param output: The dot products.
+			 * @param count: The number of vectors.
+			 * @param lanes: The number of lanes (3 or 4).
+			 */
+			inline void Dot(const float* lhs, const float* rhs, float* output, size_t count, int lanes)
+			{
+				if (lanes == 4)
+					DotLanes<0xF1>(lhs, rhs, output, count);
+				else
+					DotLanes<0x71>(lhs, rhs, output, count);
+			}
+		}
+
+		/**
+		 * AVX2 and FMA3 kernels. Two vectors are processed per register.
+		 */
+		namespace AVX2
+		{
+			/**
+			 * Transform vectors by a matrix.
+			 *
+			 * @param matrix: The matrix rows.
+			 * @param input: The input vectors.
+			 * @param output: The transformed vectors.
+			 * @param count: The number of vectors.
+			 */
+			QUICKMATH_TARGET("avx2,fma") inline void Transform(const float* matrix, const float* input, float* output, size_t count)
+			{
+				__m128 columns[4];
+				columns[0] = _mm_loadu_ps(matrix);
+				columns[1] = _mm_loadu_ps(matrix + 4);
+				columns[2] = _mm_loadu_ps(matrix + 8);
+				columns[3] = _mm_loadu_ps(matrix + 12);
+				_MM_TRANSPOSE4_PS(columns[0], columns[1], columns[2], columns[3]);
+
+				const __m256 column0 = _mm256_insertf128_ps(_mm256_castps128_ps256(columns[0]), columns[0], 1);
+				const __m256 column1 = _mm256_insertf128_ps(_mm256_castps128_ps256(columns[1]), columns[1], 1);
+				const __m256 column2 = _mm256_insertf128_ps(_mm256_castps128_ps256(columns[2]), columns[2], 1);
+				const __m256 column3 = _mm256_insertf128_ps(_mm256_castps128_ps256(columns[3]), columns[3], 1);
+
+				size_t i = 0;
+				for (; i + 2 <= count; i += 2)
+				{
+					const __m256 vectors = _mm256_loadu_ps(input + i * 4);
+					__m256 result = _mm256_mul_ps(column0, _mm256_permute_ps(vectors, _MM_SHUFFLE(0, 0, 0, 0)));
+					result = _mm256_fmadd_ps(column1, _mm256_permute_ps(vectors, _MM_SHUFFLE(1, 1, 1, 1)), result);
+					result = _mm256_fmadd_ps(column2, _mm256_permute_ps(vectors, _MM_SHUFFLE(2, 2, 2, 2)), result);
+					result = _mm256_fmadd_ps(column3, _mm256_permute_ps(vectors, _MM_SHUFFLE(3, 3, 3, 3)), result);
+					_mm256_storeu_ps(output + i * 4, result);
+				}
+
+				if (i < count)
+				{
+					const __m128 vector = _mm_loadu_ps(input + i * 4);
+					__m128 result = _mm_mul_ps(columns[0], _mm_permute_ps(vector, _MM_SHUFFLE(0, 0, 0, 0)));
+					result = _mm_fmadd_ps(columns[1], _mm_permute_ps(vector, _MM_SHUFFLE(1, 1, 1, 1)), result);
+					result = _mm_fmadd_ps(columns[2], _mm_permute_ps(vector, _MM_SHUFFLE(2, 2, 2, 2)), result);
+					result = _mm_fmadd_ps(columns[3], _mm_permute_ps(vector, _MM_SHUFFLE(3, 3, 3, 3)), result);
+					_mm_storeu_ps(output + i * 4, result);
+				}
+			}
+
+			/**
+			 * Normalize vectors using a fixed dot product mask.
+			 *
+			 * @tparam DotMask: The _mm256_dp_ps mask.
+			 * @param input: The input vectors.
+			 * @param output: The output vectors.
+			 * @param count: The number of vectors.
+			 */
+			template<int DotMask>
+			QUICKMATH_TARGET("avx2,fma") void NormalizeLanes(const float* input, float* output, size_t count)
+			{
+				size_t i = 0;
+				for (; i + 2 <= count; i += 2)
+				{
+					const __m256 vectors = _mm256_loadu_ps(input + i * 4);
+					_mm256_storeu_ps(output + i * 4, _mm256_div_ps(vectors, _mm256_sqrt_ps(_mm256_dp_ps(vectors, vectors, DotMask))));
+				}
+
+				if (i < count)
+				{
+					const __m128 vector = _mm_loadu_ps(input + i * 4);
+					_mm_storeu_ps(output + i * 4, _mm_div_ps(vector, _mm_sqrt_ps(_mm_dp_ps(vector, vector, DotMask))));
+				}
+			}
+
+			/**
+			 * Compute dot products using a fixed dot product mask.
+			 *
+			 * @tparam DotMask: The _mm256_dp_ps mask.
+			 * @param lhs: The LHS vectors.
+			 * @param rhs: The RHS vectors.
+			 * @param output: The dot products.
+			 * @param count: The number of vectors.
+			 */
+			template<int DotMask>
+			QUICKMATH_TARGET("avx2,fma") void DotLanes(const float* lhs, const float* rhs, float* output, size_t count)
+			{
+				size_t i = 0;
+				for (; i + 2 <= count; i += 2)
+				{
+					const __m256 dot = _mm256_dp_ps(_mm256_loadu_ps(lhs + i * 4), _mm256_loadu_ps(rhs + i * 4), DotMask);
+					_mm_store_ss(output + i, _mm256_castps256_ps128(dot));
+					_mm_store_ss(output + i + 1, _mm256_extractf128_ps(dot, 1));
+				}
+
+				if (i < count)
+					_mm_store_ss(output + i, _mm_dp_ps(_mm_loadu_ps(lhs + i * 4), _mm_loadu_ps(rhs + i * 4), DotMask));
+			}
+
+			/**
+			 * Normalize vectors.
+			 *
+			 * @param input: The input vectors.
+			 * @param output: The output vectors.
+			 * @param count: The number of vectors.
+			 * @param lanes: The number of lanes (3 or 4).
+			 */
+			inline void Normalize(const float* input, float* output, size_t count, int lanes)
+			{
+				if (lanes == 4)
+					NormalizeLanes<0xFF>(input, output, count);
+				else
+					NormalizeLanes<0x7F>(input, output, count);
+			}
+
+			/**
+			 * Compute the dot products of two vector arrays.
+			 *
+			 * @param lhs: The LHS vectors.
+			 * @param rhs: The RHS vectors.
+			 * @param output: The dot products.
+			 * @param count: The number of vectors.
+			 * @param lanes: The number of lanes (3 or 4).
+			 */
+			inline void Dot(const float* lhs, const float* rhs, float* output, size_t count, int lanes)
+			{
+				if (lanes == 4)
+					DotLanes<0xF1>(lhs, rhs, output, count);
+				else
+					DotLanes<0x71>(lhs, rhs, output, count);
+			}
+		}
+
+		/**
+		 * AVX-512F kernels. Four vectors are processed per register, and the tail uses masked loads and stores.
+		 */
+		namespace AVX512
+		{
+			/**
+			 * Get the load/ store mask for the remaining vectors of an array.
+			 *
+			 * @param remaining: The number of remaining vectors (0 - 4).
+			 * @return The lane mask.
+			 */
+			inline __mmask16 TailMask(size_t remaining)
+			{
+				return static_cast<__mmask16>((1u << (remaining * 4)) - 1u);
+			}
+
+			/**
+			 * Sum the lanes of each vector in a register.
+			 *
+			 * @param product: The products of the four vectors.
+			 * @return The sums, splatted to the lanes of each vector.
+			 */
+			QUICKMATH_TARGET("avx512f") inline __m512 Sum(__m512 product)
+			{
+				const __m512 sum = _mm512_add_ps(product, _mm512_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+				return _mm512_add_ps(sum, _mm512_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+			}
+
+			/**
+			 * Transform vectors by a matrix.
+			 *
+			 * @param matrix: The matrix rows.
+			 * @param input: The input vectors.
+			 * @param output: The transformed vectors.
+			 * @param count: The number of vectors.
+			 */
+			QUICKMATH_TARGET("avx512f") inline void Transform(const float* matrix, const float* input, float* output, size_t count)
+			{
+				__m128 columns[4];
+				columns[0] = _mm_loadu_ps(matrix);
+				columns[1] = _mm_loadu_ps(matrix + 4);
+				columns[2] = _mm_loadu_ps(matrix + 8);
+				columns[3] = _mm_loadu_ps(matrix + 12);
+				_MM_TRANSPOSE4_PS(columns[0], columns[1], columns[2], columns[3]);
+
+				const __m512 column0 = _mm512_broadcast_f32x4(columns[0]);
+				const __m512 column1 = _mm512_broadcast_f32x4(columns[1]);
+				const __m512 column2 = _mm512_broadcast_f32x4(columns[2]);
+				const __m512 column3 = _mm512_broadcast_f32x4(columns[3]);
+
+				for (size_t i = 0; i < count; i += 4)
+				{
+					const __mmask16 mask = count - i < 4 ? TailMask(count - i) : static_cast<__mmask16>(0xFFFF);
+					const __m512 vectors = _mm512_maskz_loadu_ps(mask, input + i * 4);
+					__m512 result = _mm512_mul_ps(column0, _mm512_shuffle_ps(vectors, vectors, _MM_SHUFFLE(0, 0, 0, 0)));
+					result = _mm512_fmadd_ps(column1, _mm512_shuffle_ps(vectors, vectors, _MM_SHUFFLE(1, 1, 1, 1)), result);
+					result = _mm512_fmadd_ps(column2, _mm512_shuffle_ps(vectors, vectors, _MM_SHUFFLE(2, 2, 2, 2)), result);
+					result = _mm512_fmadd_ps(column3, _mm512_shuffle_ps(vectors, vectors, _MM_SHUFFLE(3, 3, 3, 3)), result);
+					_mm512_mask_storeu_ps(output + i * 4, mask, result);
+				}
+			}
+
+			/**
+			 * Normalize vectors.
+			 *
+			 * @param input: The input vectors.
+			 * @param output: The output vectors.
+			 * @param count: The number of vectors.
+			 * @param lanes: The number of lanes (3 or 4).
+			 */
+			QUICKMATH_TARGET("avx512f") inline void Normalize(const float* input, float* output, size_t count, int lanes)
+			{
+				const __mmask16 laneMask = lanes == 4 ? static_cast<__mmask16>(0xFFFF) : static_cast<__mmask16>(0x7777);
+				for (size_t i = 0; i < count; i += 4)
+				{
+					const __mmask16 mask = count - i < 4 ? TailMask(count - i) : static_cast<__mmask16>(0xFFFF);
+					const __m512 vectors = _mm512_maskz_loadu_ps(mask, input + i * 4);
+					const __m512 lengthSquared = Sum(_mm512_maskz_mul_ps(laneMask, vectors, vectors));
+					_mm512_mask_storeu_ps(output + i * 4, mask, _mm512_div_ps(vectors, _mm512_sqrt_ps(lengthSquared)));
+				}
+			}
+
+			/**
+			 * Compute the dot products of two vector arrays.
+			 *
+			 * @param lhs: The LHS vectors.
+			 * @param rhs: The RHS vectors.
+			 * @param output: The dot products.
+			 * @param count: The number of vectors.
+			 * @param lanes: The number of lanes (3 or 4).
+			 */
+			QUICKMATH_TARGET("avx512f") inline void Dot(const float* lhs, const float* rhs, float* output, size_t count, int lanes)
+			{
+				const __mmask16 laneMask = lanes == 4 ? static_cast<__mmask16>(0xFFFF) : static_cast<__mmask16>(0x7777);
+				const __m512i firstLanes = _mm512_setr_epi32(0, 4, 8, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+				for (size_t i = 0; i < count; i += 4)
+				{
+					const size_t remaining = count - i < 4 ? count - i : 4;
+					const __mmask16 mask = TailMask(remaining);
+					const __m512 product = _mm512_maskz_mul_ps(laneMask, _mm512_maskz_loadu_ps(mask, lhs + i * 4), _mm512_maskz_loadu_ps(mask, rhs + i * 4));
+					const __m512 sums = _mm512_permutexvar_ps(firstLanes, Sum(product));
+					_mm512_mask_storeu_ps(output + i, static_cast<__mmask16>((1u << remaining) - 1u), sums);
+				}
+			}
+		}
+	}
+}
@@ -18,7 +18,10 @@ struct IntrinsicTraits {};
 #endif
 
 #ifndef SSE_INSTR_SET
-#   if defined ( __AVX2__ )
+#   if defined ( __AVX512F__ )
+#       define SSE_INSTR_SET        9
+
+#   elif defined ( __AVX2__ )
 #       define SSE_INSTR_SET        8
 
 #   elif defined ( __AVX__ )
@@ -52,8 +55,30 @@ struct IntrinsicTraits {};
 
 #endif // SSE_INSTR_SET
 
+#ifndef FMA_INSTR_SET
+#   if defined ( __FMA__ ) || ( defined ( _MSC_VER ) && defined ( __AVX2__ ) )
+#       define FMA_INSTR_SET        1
+
+#   else
+#       define FMA_INSTR_SET        0
+
+#   endif // FMA defines
+
+#endif // FMA_INSTR_SET
+
+#ifndef F16C_INSTR_SET
+#   if defined ( __F16C__ ) || ( defined ( _MSC_VER ) && defined ( __AVX2__ ) )
+#       define F16C_INSTR_SET       1
+
+#   else
+#       define F16C_INSTR_SET       0
+
+#   endif // F16C defines
+
+#endif // F16C_INSTR_SET
+
 // Include the appropriate header file for intrinsic functions
-#if SSE_INSTR_SET > 7                  // AVX2 and later
+#if SSE_INSTR_SET > 7                  // AVX2, AVX-512 and later
 #   ifdef __GNUC__
 #       include <x86intrin.h>         // x86intrin.h 
 #   else
@@ -61,16 +86,6 @@ struct IntrinsicTraits {};
 #   endif // __GNUC__
 #elif SSE_INSTR_SET == 7
 #   include <immintrin.h>             // AVX
-
-	template<>
-	struct IntrinsicTraits<float, 8> { typedef __m256 Type; };
-
-	template<>
-	struct IntrinsicTraits<double, 3> { typedef __m256d Type; };
-	
-	template<>
-	struct IntrinsicTraits<double, 4> { typedef __m256d Type; };
-
 #elif SSE_INSTR_SET == 6
 #   include <nmmintrin.h>             // SSE4.2
 #elif SSE_INSTR_SET == 5
@@ -92,8 +107,55 @@ struct IntrinsicTraits {};
 #   endif
 #endif
 
+// FMA3 and F16C live in immintrin.h, which the SSE only branches above do not include.
+#if (FMA_INSTR_SET > 0 || F16C_INSTR_SET > 0) && SSE_INSTR_SET < 7
+#   include <immintrin.h>
+#endif
+
+template<>
+struct IntrinsicTraits<float, 2> { typedef __m128 Type; };
+
 template<>
 struct IntrinsicTraits<float, 3> { typedef __m128 Type; };
 
 template<>
 struct IntrinsicTraits<float, 4> { typedef __m128 Type; };
+
+template<>
+struct IntrinsicTraits<int, 3> { typedef __m128i Type; };
+
+template<>
+struct IntrinsicTraits<int, 4> { typedef __m128i Type; };
+
+#if SSE_INSTR_SET > 6
+template<>
+struct IntrinsicTraits<float, 8> { typedef __m256 Type; };
+
+template<>
+struct IntrinsicTraits<double, 3> { typedef __m256d Type; };
+
+template<>
+struct IntrinsicTraits<double, 4> { typedef __m256d Type; };
+
+#if SSE_INSTR_SET > 8
+template<>
+struct IntrinsicTraits<float, 16> { typedef __m512 Type; };
+
+#endif // SSE_INSTR_SET > 8
+
+#else
+/**
+ * Two SSE2 double registers, used in place of __m256d when AVX is not available.
+ */
+struct DoubleRegisterPair
+{
+	__m128d xy, zw;
+};
+
+template<>
+struct IntrinsicTraits<double, 3> { typedef DoubleRegisterPair Type; };
+
+template<>
+struct IntrinsicTraits<double, 4> { typedef DoubleRegisterPair Type; };
+
+#endif // SSE_INSTR_SET > 6
@@ -0,0 +1,1275 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "IncludeSIMD.h"
+
+#include <cmath>
+#include <limits>
+
+namespace QuickMath
+{
+	/**
+	 * Store mode of the batch operations.
+	 * NonTemporal writes the results around the caches (movntps). Use it when the output is larger than the cache and is not read
+	 * again soon, so it does not evict the data that is.
+	 */
+	enum class StoreMode : unsigned char
+	{
+		Cached,
+		NonTemporal
+	};
+
+	/**
+	 * Tag to construct a vector or a matrix without initializing it.
+	 * The default constructors zero the components. Pass Uninitialized instead for values which are written before they are read, such
+	 * as the temporaries of the batch operations. Reading a value before it is written is undefined behavior.
+	 */
+	struct UninitializedTag {};
+
+	/**
+	 * The uninitialized construction tag.
+	 */
+	constexpr UninitializedTag Uninitialized = {};
+
+	/**
+	 * The default relative tolerance of the checked inverses (Matrix33::Inverse, Matrix44::Inverse, Transform3x4::InverseAffine).
+	 * The rows are scaled to unit length first, and the matrix is taken as singular when the determinant of that is <= tolerance,
+	 * see Intrinsics::IsInvertible.
+	 */
+	constexpr float DefaultInverseTolerance = 1e-6f;
+
+	/**
+	 * The default relative tolerance of the checked double precision inverse (Matrix44d::Inverse), in the same terms as
+	 * DefaultInverseTolerance.
+	 */
+	constexpr double DefaultInverseToleranceDouble = 1e-12;
+
+	/**
+	 * Low level SIMD helpers.
+	 * The vector and matrix types are built on these functions so that the instruction set specific code lives in one place.
+	 */
+	namespace Intrinsics
+	{
+		/**
+		 * Broadcast one lane of a register to all four lanes.
+		 *
+		 * @tparam Lane: The lane to broadcast.
+		 * @param value: The register.
+		 * @return The splatted lane.
+		 */
+		template<int Lane>
+		inline __m128 Splat(__m128 value)
+		{
+			return _mm_shuffle_ps(value, value, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+		}
+
+		/**
+		 * Store a register.
+		 *
+		 * @tparam Mode: The store mode.
+		 * @param destination: The destination. It must be 16 byte aligned for non-temporal stores.
+		 * @param value: The register.
+		 */
+		template<StoreMode Mode>
+		inline void Store(float* destination, __m128 value)
+		{
+			if (Mode == StoreMode::NonTemporal)
+				_mm_stream_ps(destination, value);
+			else
+				_mm_storeu_ps(destination, value);
+		}
+
+		/**
+		 * Sum all four lanes of a register.
+		 *
+		 * @param value: The register to reduce.
+		 * @return The sum, splatted to all four lanes.
+		 */
+		inline __m128 HorizontalSum(__m128 value)
+		{
+#if SSE_INSTR_SET > 2
+			__m128 sum = _mm_hadd_ps(value, value);
+			return _mm_hadd_ps(sum, sum);
+
+#else
+			__m128 sum = _mm_add_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+			return _mm_add_ps(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 0, 3, 2)));
+
+#endif // SSE_INSTR_SET > 2
+		}
+
+		/**
+		 * Compute a * b + c.
+		 * This is a single fused instruction (one rounding) when FMA3 is available.
+		 *
+		 * @param a: The first multiplicand.
+		 * @param b: The second multiplicand.
+		 * @param c: The addend.
+		 * @return The result.
+		 */
+		inline __m128 MulAdd(__m128 a, __m128 b, __m128 c)
+		{
+#if FMA_INSTR_SET > 0
+			return _mm_fmadd_ps(a, b, c);
+
+#else
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+
+#endif // FMA_INSTR_SET > 0
+		}
+
+		/**
+		 * Compute a * b - c.
+		 * This is a single fused instruction (one rounding) when FMA3 is available.
+		 *
+		 * @param a: The first multiplicand.
+		 * @param b: The second multiplicand.
+		 * @param c: The subtrahend.
+		 * @return The result.
+		 */
+		inline __m128 MulSub(__m128 a, __m128 b, __m128 c)
+		{
+#if FMA_INSTR_SET > 0
+			return _mm_fmsub_ps(a, b, c);
+
+#else
+			return _mm_sub_ps(_mm_mul_ps(a, b), c);
+
+#endif // FMA_INSTR_SET > 0
+		}
+
+		/**
+		 * Compute c - a * b.
+		 * This is a single fused instruction (one rounding) when FMA3 is available.
+		 *
+		 * @param a: The first multiplicand.
+		 * @param b: The second multiplicand.
+		 * @param c: The value to subtract the product from.
+		 * @return The result.
+		 */
+		inline __m128 NegMulAdd(__m128 a, __m128 b, __m128 c)
+		{
+#if FMA_INSTR_SET > 0
+			return _mm_fnmadd_ps(a, b, c);
+
+#else
+			return _mm_sub_ps(c, _mm_mul_ps(a, b));
+
+#endif // FMA_INSTR_SET > 0
+		}
+
+#if SSE_INSTR_SET > 6
+		/**
+		 * Compute a * b + c on 8 lane registers.
+		 * This is a single fused instruction (one rounding) when FMA3 is available.
+		 *
+		 * @param a: The first multiplicand.
+		 * @param b: The second multiplicand.
+		 * @param c: The addend.
+		 * @return The result.
+		 */
+		inline __m256 MulAdd(__m256 a, __m256 b, __m256 c)
+		{
+#if FMA_INSTR_SET > 0
+			return _mm256_fmadd_ps(a, b, c);
+
+#else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+
+#endif // FMA_INSTR_SET > 0
+		}
+
+		/**
+		 * Compute a * b - c on 8 lane registers.
+		 * This is a single fused instruction (one rounding) when FMA3 is available.
+		 *
+		 * @param a: The first multiplicand.
+		 * @param b: The second multiplicand.
+		 * @param c: The subtrahend.
+		 * @return The result.
+		 */
+		inline __m256 MulSub(__m256 a, __m256 b, __m256 c)
+		{
+#if FMA_INSTR_SET > 0
+			return _mm256_fmsub_ps(a, b, c);
+
+#else
+			return _mm256_sub_ps(_mm256_mul_ps(a, b), c);
+
+#endif // FMA_INSTR_SET > 0
+		}
+
+		/**
+		 * Compute c - a * b on 8 lane registers.
+		 * This is a single fused instruction (one rounding) when FMA3 is available.
+		 *
+		 * @param a: The first multiplicand.
+		 * @param b: The second multiplicand.
+		 * @param c: The value to subtract the product from.
+		 * @return The result.
+		 */
+		inline __m256 NegMulAdd(__m256 a, __m256 b, __m256 c)
+		{
+#if FMA_INSTR_SET > 0
+			return _mm256_fnmadd_ps(a, b, c);
+
+#else
+			return _mm256_sub_ps(c, _mm256_mul_ps(a, b));
+
+#endif // FMA_INSTR_SET > 0
+		}
+
+		/**
+		 * Sum all eight lanes of a register.
+		 *
+		 * @param value: The register to reduce.
+		 * @return The sum.
+		 */
+		inline float HorizontalSum(__m256 value)
+		{
+			const __m128 sum = HorizontalSum(_mm_add_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1)));
+			return _mm_cvtss_f32(sum);
+		}
+
+#endif // SSE_INSTR_SET > 6
+
+#if SSE_INSTR_SET > 8
+		/**
+		 * Compute a * b + c on 16 lane registers. AVX-512 always has the fused form.
+		 *
+		 * @param a: The first multiplicand.
+		 * @param b: The second multiplicand.
+		 * @param c: The addend.
+		 * @return The result.
+		 */
+		inline __m512 MulAdd(__m512 a, __m512 b, __m512 c)
+		{
+			return _mm512_fmadd_ps(a, b, c);
+		}
+
+		/**
+		 * Compute a * b - c on 16 lane registers. AVX-512 always has the fused form.
+		 *
+		 * @param a: The first multiplicand.
+		 * @param b: The second multiplicand.
+		 * @param c: The subtrahend.
+		 * @return The result.
+		 */
+		inline __m512 MulSub(__m512 a, __m512 b, __m512 c)
+		{
+			return _mm512_fmsub_ps(a, b, c);
+		}
+
+		/**
+		 * Compute c - a * b on 16 lane registers. AVX-512 always has the fused form.
+		 *
+		 * @param a: The first multiplicand.
+		 * @param b: The second multiplicand.
+		 * @param c: The value to subtract the product from.
+		 * @return The result.
+		 */
+		inline __m512 NegMulAdd(__m512 a, __m512 b, __m512 c)
+		{
+			return _mm512_fnmadd_ps(a, b, c);
+		}
+
+		/**
+		 * Sum all sixteen lanes of a register.
+		 *
+		 * @param value: The register to reduce.
+		 * @return The sum.
+		 */
+		inline float HorizontalSum(__m512 value)
+		{
+			return _mm512_reduce_add_ps(value);
+		}
+
+#endif // SSE_INSTR_SET > 8
+
+		/**
+		 * Compute the dot product of the x, y and z lanes of two registers.
+		 * The w lanes are ignored.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The dot product, splatted to all four lanes.
+		 */
+		inline __m128 Dot3(__m128 lhs, __m128 rhs)
+		{
+#if SSE_INSTR_SET > 4
+			return _mm_dp_ps(lhs, rhs, 0x7F);
+
+#elif SSE_INSTR_SET > 2
+			const __m128 product = _mm_and_ps(_mm_mul_ps(lhs, rhs), _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+			return HorizontalSum(product);
+
+#else
+			const __m128 product = _mm_mul_ps(lhs, rhs);
+			__m128 sum = _mm_add_ss(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 1, 1, 1)));
+			sum = _mm_add_ss(sum, _mm_movehl_ps(product, product));
+			return _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(0, 0, 0, 0));
+
+#endif // SSE_INSTR_SET > 4
+		}
+
+		/**
+		 * Compute the dot product of all four lanes of two registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The dot product, splatted to all four lanes.
+		 */
+		inline __m128 Dot4(__m128 lhs, __m128 rhs)
+		{
+#if SSE_INSTR_SET > 4
+			return _mm_dp_ps(lhs, rhs, 0xFF);
+
+#else
+			return HorizontalSum(_mm_mul_ps(lhs, rhs));
+
+#endif // SSE_INSTR_SET > 4
+		}
+
+		/**
+		 * Compute the cross product of the x, y and z lanes of two registers.
+		 * The w lane of the result is lhs.w * rhs.w - rhs.w * lhs.w, which is 0 for finite inputs.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The cross product.
+		 */
+		inline __m128 Cross3(__m128 lhs, __m128 rhs)
+		{
+			// (lhs * rhs.yzx - lhs.yzx * rhs).yzx needs one shuffle less than the textbook form.
+			const __m128 lhsYZX = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 rhsYZX = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 result = _mm_sub_ps(_mm_mul_ps(lhs, rhsYZX), _mm_mul_ps(lhsYZX, rhs));
+			return _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 0, 2, 1));
+		}
+
+		/**
+		 * Compute the reciprocal lengths of four rows.
+		 * Pass the rows of a 3x3 matrix with their w lanes cleared and (0, 0, 0, 1) as the fourth row.
+		 * A row of length 0 gives an infinity, and a row whose squared length is not a normal float gives an infinity or a 0.
+		 *
+		 * @param row0: The first row.
+		 * @param row1: The second row.
+		 * @param row2: The third row.
+		 * @param row3: The fourth row.
+		 * @return The reciprocal lengths, one row per lane.
+		 */
+		inline __m128 InverseRowLengths(__m128 row0, __m128 row1, __m128 row2, __m128 row3)
+		{
+			row0 = _mm_mul_ps(row0, row0);
+			row1 = _mm_mul_ps(row1, row1);
+			row2 = _mm_mul_ps(row2, row2);
+			row3 = _mm_mul_ps(row3, row3);
+			_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+			return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(row0, row1), _mm_add_ps(row2, row3))));
+		}
+
+		/**
+		 * Check whether the determinant of a matrix with unit length rows is large enough to invert the matrix with.
+		 * By Hadamard's inequality such a determinant is at most 1 (when the rows are orthogonal), so tolerance is relative. The
+		 * test fails when the determinant is not finite, which is the case when a row had a length of 0.
+		 *
+		 * @param determinant: The determinant of the row normalized matrix, in the first lane.
+		 * @param tolerance: The relative tolerance.
+		 * @return True if the matrix can be inverted.
+		 */
+		inline bool IsInvertible(__m128 determinant, float tolerance)
+		{
+			const __m128 magnitude = _mm_andnot_ps(_mm_set1_ps(-0.0f), determinant);
+			return _mm_comigt_ss(magnitude, _mm_set_ss(tolerance)) != 0 && _mm_comilt_ss(magnitude, _mm_set_ss(std::numeric_limits<float>::infinity())) != 0;
+		}
+
+		/**
+		 * Check whether all the lanes of four registers are finite.
+		 *
+		 * @param value0: The first register.
+		 * @param value1: The second register.
+		 * @param value2: The third register.
+		 * @param value3: The fourth register.
+		 * @return True if no lane is an infinity or a NaN.
+		 */
+		inline bool AllFinite(__m128 value0, __m128 value1, __m128 value2, __m128 value3)
+		{
+			// x * 0 is 0 for finite x and NaN for infinities and NaNs, and a NaN survives the sums.
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(value0, zero), _mm_mul_ps(value1, zero)),
+				_mm_add_ps(_mm_mul_ps(value2, zero), _mm_mul_ps(value3, zero)));
+
+			return _mm_movemask_ps(_mm_cmpord_ps(sum, sum)) == 0xF;
+		}
+
+		/**
+		 * Multiply the 32 bit integer lanes of two registers and keep the low 32 bits of each product.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The products.
+		 */
+		inline __m128i MulLo(__m128i lhs, __m128i rhs)
+		{
+#if SSE_INSTR_SET > 4
+			return _mm_mullo_epi32(lhs, rhs);
+
+#else
+			// _mm_mul_epu32 multiplies lanes 0 and 2; the low 32 bits are the same for signed and unsigned inputs.
+			const __m128i even = _mm_mul_epu32(lhs, rhs);
+			const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(lhs, 32), _mm_srli_epi64(rhs, 32));
+			return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+
+#endif // SSE_INSTR_SET > 4
+		}
+
+		/**
+		 * Get the signed 32 bit minimum of each lane of two registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The minimums.
+		 */
+		inline __m128i Min(__m128i lhs, __m128i rhs)
+		{
+#if SSE_INSTR_SET > 4
+			return _mm_min_epi32(lhs, rhs);
+
+#else
+			const __m128i greater = _mm_cmpgt_epi32(lhs, rhs);
+			return _mm_or_si128(_mm_and_si128(greater, rhs), _mm_andnot_si128(greater, lhs));
+
+#endif // SSE_INSTR_SET > 4
+		}
+
+		/**
+		 * Get the signed 32 bit maximum of each lane of two registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The maximums.
+		 */
+		inline __m128i Max(__m128i lhs, __m128i rhs)
+		{
+#if SSE_INSTR_SET > 4
+			return _mm_max_epi32(lhs, rhs);
+
+#else
+			const __m128i greater = _mm_cmpgt_epi32(lhs, rhs);
+			return _mm_or_si128(_mm_and_si128(greater, lhs), _mm_andnot_si128(greater, rhs));
+
+#endif // SSE_INSTR_SET > 4
+		}
+
+		/**
+		 * Convert four floats to half precision, rounding to nearest even.
+		 * This is a single vcvtps2ph when F16C is available. The SSE2 fallback gives the same bits, denormals, infinities and NaNs included.
+		 *
+		 * @param value: The floats.
+		 * @return The four halves, in the low 64 bits.
+		 */
+		inline __m128i FloatToHalf(__m128 value)
+		{
+#if F16C_INSTR_SET > 0
+			return _mm_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT);
+
+#else
+			const __m128i infinity32 = _mm_set1_epi32(0x7f800000);
+			const __m128i overflow = _mm_set1_epi32((127 + 16) << 23);		// Everything from 65520 up rounds to infinity.
+			const __m128i minimumNormal = _mm_set1_epi32((127 - 14) << 23);	// The smallest float that is a normal half.
+			const __m128i denormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+			const __m128i normalBias = _mm_set1_epi32(0xfff - ((127 - 15) << 23));
+
+			const __m128i sign = _mm_castps_si128(_mm_and_ps(value, _mm_set1_ps(-0.0f)));
+			const __m128i absolute = _mm_xor_si128(_mm_castps_si128(value), sign);
+
+			// Infinity, or a NaN which is quieted and keeps the top of its payload (like vcvtps2ph).
+			const __m128i isNaN = _mm_cmpgt_epi32(absolute, infinity32);
+			const __m128i payload = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(absolute, 13), _mm_set1_epi32(0x3ff)), _mm_set1_epi32(0x200));
+			const __m128i special = _mm_or_si128(_mm_and_si128(isNaN, payload), _mm_set1_epi32(0x7c00));
+
+			// Denormal halves: adding the magic value lets the float adder do the shift and the rounding.
+			const __m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(absolute), _mm_castsi128_ps(denormalMagic))), denormalMagic);
+
+			// Normal halves: rebias the exponent and round the mantissa to nearest even.
+			const __m128i odd = _mm_srai_epi32(_mm_slli_epi32(absolute, 31 - 13), 31);
+			const __m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(absolute, normalBias), odd), 13);
+
+			const __m128i isDenormal = _mm_cmpgt_epi32(minimumNormal, absolute);
+			const __m128i isFinite = _mm_cmpgt_epi32(overflow, absolute);
+			__m128i result = _mm_or_si128(_mm_and_si128(isDenormal, denormal), _mm_andnot_si128(isDenormal, normal));
+			result = _mm_or_si128(_mm_and_si128(isFinite, result), _mm_andnot_si128(isFinite, special));
+
+			// The arithmetic shift makes negative lanes 0xffff8000, which the signed saturation packs to 0x8000.
+			result = _mm_or_si128(result, _mm_srai_epi32(sign, 16));
+			return _mm_packs_epi32(result, result);
+
+#endif // F16C_INSTR_SET > 0
+		}
+
+		/**
+		 * Convert four halves to single precision.
+		 * This is a single vcvtph2ps when F16C is available. The conversion is exact, and the SSE2 fallback gives the same bits.
+		 *
+		 * @param value: The four halves, in the low 64 bits.
+		 * @return The floats.
+		 */
+		inline __m128 HalfToFloat(__m128i value)
+		{
+#if F16C_INSTR_SET > 0
+			return _mm_cvtph_ps(value);
+
+#else
+			const __m128i halves = _mm_unpacklo_epi16(value, _mm_setzero_si128());
+			const __m128i absolute = _mm_and_si128(halves, _mm_set1_epi32(0x7fff));
+			const __m128i sign = _mm_slli_epi32(_mm_xor_si128(halves, absolute), 16);
+
+			// Shifting puts the exponent and mantissa in place, and the multiply rebiases the exponent (and normalizes the denormals).
+			const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(absolute, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+
+			// Infinities and NaNs need the maximum exponent, which the multiply cannot reach. NaNs are quieted, like vcvtph2ps.
+			const __m128i isSpecial = _mm_cmpgt_epi32(absolute, _mm_set1_epi32(0x7bff));
+			const __m128i isNaN = _mm_cmpgt_epi32(absolute, _mm_set1_epi32(0x7c00));
+			const __m128i specialExponent = _mm_or_si128(_mm_and_si128(isSpecial, _mm_set1_epi32(255 << 23)), _mm_and_si128(isNaN, _mm_set1_epi32(0x00400000)));
+
+			return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, specialExponent)));
+
+#endif // F16C_INSTR_SET > 0
+		}
+
+		/**
+		 * The double precision register type.
+		 * This is an __m256d on AVX and a pair of __m128d registers on SSE2.
+		 */
+		typedef IntrinsicTraits<double, 4>::Type DoubleRegister;
+
+		/**
+		 * Create a double register from four values.
+		 *
+		 * @param x: The x lane.
+		 * @param y: The y lane.
+		 * @param z: The z lane.
+		 * @param w: The w lane.
+		 * @return The register.
+		 */
+		inline DoubleRegister SetDouble(double x, double y, double z, double w)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_setr_pd(x, y, z, w);
+
+#else
+			return DoubleRegister{ _mm_setr_pd(x, y), _mm_setr_pd(z, w) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Broadcast a value to all four lanes of a double register.
+		 *
+		 * @param value: The value.
+		 * @return The register.
+		 */
+		inline DoubleRegister Set1Double(double value)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_set1_pd(value);
+
+#else
+			return DoubleRegister{ _mm_set1_pd(value), _mm_set1_pd(value) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Convert four floats to doubles.
+		 *
+		 * @param value: The float register.
+		 * @return The double register.
+		 */
+		inline DoubleRegister ToDouble(__m128 value)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_cvtps_pd(value);
+
+#else
+			return DoubleRegister{ _mm_cvtps_pd(value), _mm_cvtps_pd(_mm_movehl_ps(value, value)) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Convert four doubles to floats (rounded to nearest).
+		 *
+		 * @param value: The double register.
+		 * @return The float register.
+		 */
+		inline __m128 ToFloat(DoubleRegister value)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_cvtpd_ps(value);
+
+#else
+			return _mm_movelh_ps(_mm_cvtpd_ps(value.xy), _mm_cvtpd_ps(value.zw));
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Add two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The result.
+		 */
+		inline DoubleRegister Add(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_add_pd(lhs, rhs);
+
+#else
+			return DoubleRegister{ _mm_add_pd(lhs.xy, rhs.xy), _mm_add_pd(lhs.zw, rhs.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Subtract two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The result.
+		 */
+		inline DoubleRegister Sub(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_sub_pd(lhs, rhs);
+
+#else
+			return DoubleRegister{ _mm_sub_pd(lhs.xy, rhs.xy), _mm_sub_pd(lhs.zw, rhs.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Multiply two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The result.
+		 */
+		inline DoubleRegister Mul(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_mul_pd(lhs, rhs);
+
+#else
+			return DoubleRegister{ _mm_mul_pd(lhs.xy, rhs.xy), _mm_mul_pd(lhs.zw, rhs.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Divide two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The result.
+		 */
+		inline DoubleRegister Div(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_div_pd(lhs, rhs);
+
+#else
+			return DoubleRegister{ _mm_div_pd(lhs.xy, rhs.xy), _mm_div_pd(lhs.zw, rhs.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Component-wise equal to comparison of two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The lane mask.
+		 */
+		inline DoubleRegister CompareEqual(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ);
+
+#else
+			return DoubleRegister{ _mm_cmpeq_pd(lhs.xy, rhs.xy), _mm_cmpeq_pd(lhs.zw, rhs.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Component-wise not equal to comparison of two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The lane mask.
+		 */
+		inline DoubleRegister CompareNotEqual(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_cmp_pd(lhs, rhs, _CMP_NEQ_UQ);
+
+#else
+			return DoubleRegister{ _mm_cmpneq_pd(lhs.xy, rhs.xy), _mm_cmpneq_pd(lhs.zw, rhs.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Component-wise less than comparison of two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The lane mask.
+		 */
+		inline DoubleRegister CompareLess(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OS);
+
+#else
+			return DoubleRegister{ _mm_cmplt_pd(lhs.xy, rhs.xy), _mm_cmplt_pd(lhs.zw, rhs.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Component-wise less than or equal to comparison of two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The lane mask.
+		 */
+		inline DoubleRegister CompareLessEqual(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_cmp_pd(lhs, rhs, _CMP_LE_OS);
+
+#else
+			return DoubleRegister{ _mm_cmple_pd(lhs.xy, rhs.xy), _mm_cmple_pd(lhs.zw, rhs.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Component-wise greater than comparison of two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The lane mask.
+		 */
+		inline DoubleRegister CompareGreater(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_cmp_pd(lhs, rhs, _CMP_GT_OS);
+
+#else
+			return DoubleRegister{ _mm_cmpgt_pd(lhs.xy, rhs.xy), _mm_cmpgt_pd(lhs.zw, rhs.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Component-wise greater than or equal to comparison of two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The lane mask.
+		 */
+		inline DoubleRegister CompareGreaterEqual(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_cmp_pd(lhs, rhs, _CMP_GE_OS);
+
+#else
+			return DoubleRegister{ _mm_cmpge_pd(lhs.xy, rhs.xy), _mm_cmpge_pd(lhs.zw, rhs.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Compute the square root of all four lanes.
+		 *
+		 * @param value: The double register.
+		 * @return The square roots.
+		 */
+		inline DoubleRegister Sqrt(DoubleRegister value)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_sqrt_pd(value);
+
+#else
+			return DoubleRegister{ _mm_sqrt_pd(value.xy), _mm_sqrt_pd(value.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Compute a * b + c on double registers.
+		 * This is a single fused instruction (one rounding) when FMA3 is available.
+		 *
+		 * @param a: The first multiplicand.
+		 * @param b: The second multiplicand.
+		 * @param c: The addend.
+		 * @return The result.
+		 */
+		inline DoubleRegister MulAdd(DoubleRegister a, DoubleRegister b, DoubleRegister c)
+		{
+#if SSE_INSTR_SET > 6 && FMA_INSTR_SET > 0
+			return _mm256_fmadd_pd(a, b, c);
+
+#else
+			return Add(Mul(a, b), c);
+
+#endif // SSE_INSTR_SET > 6 && FMA_INSTR_SET > 0
+		}
+
+		/**
+		 * Compute a * b - c on double registers.
+		 * This is a single fused instruction (one rounding) when FMA3 is available.
+		 *
+		 * @param a: The first multiplicand.
+		 * @param b: The second multiplicand.
+		 * @param c: The subtrahend.
+		 * @return The result.
+		 */
+		inline DoubleRegister MulSub(DoubleRegister a, DoubleRegister b, DoubleRegister c)
+		{
+#if SSE_INSTR_SET > 6 && FMA_INSTR_SET > 0
+			return _mm256_fmsub_pd(a, b, c);
+
+#else
+			return Sub(Mul(a, b), c);
+
+#endif // SSE_INSTR_SET > 6 && FMA_INSTR_SET > 0
+		}
+
+		/**
+		 * Compute c - a * b on double registers.
+		 * This is a single fused instruction (one rounding) when FMA3 is available.
+		 *
+		 * @param a: The first multiplicand.
+		 * @param b: The second multiplicand.
+		 * @param c: The value to subtract the product from.
+		 * @return The result.
+		 */
+		inline DoubleRegister NegMulAdd(DoubleRegister a, DoubleRegister b, DoubleRegister c)
+		{
+#if SSE_INSTR_SET > 6 && FMA_INSTR_SET > 0
+			return _mm256_fnmadd_pd(a, b, c);
+
+#else
+			return Sub(c, Mul(a, b));
+
+#endif // SSE_INSTR_SET > 6 && FMA_INSTR_SET > 0
+		}
+
+		/**
+		 * Bitwise AND of two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The result.
+		 */
+		inline DoubleRegister And(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_and_pd(lhs, rhs);
+
+#else
+			return DoubleRegister{ _mm_and_pd(lhs.xy, rhs.xy), _mm_and_pd(lhs.zw, rhs.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Bitwise OR of two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The result.
+		 */
+		inline DoubleRegister Or(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_or_pd(lhs, rhs);
+
+#else
+			return DoubleRegister{ _mm_or_pd(lhs.xy, rhs.xy), _mm_or_pd(lhs.zw, rhs.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Bitwise XOR of two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The result.
+		 */
+		inline DoubleRegister Xor(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_xor_pd(lhs, rhs);
+
+#else
+			return DoubleRegister{ _mm_xor_pd(lhs.xy, rhs.xy), _mm_xor_pd(lhs.zw, rhs.zw) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Select the lanes of two double registers using a compare result.
+		 * This is a single blendv on AVX, and uses _mm_blendv_pd on SSE4.1.
+		 *
+		 * @param mask: The compare result.
+		 * @param ifTrue: The register to take the lanes from where the mask is true.
+		 * @param ifFalse: The register to take the lanes from where the mask is false.
+		 * @return The selected lanes.
+		 */
+		inline DoubleRegister Blend(DoubleRegister mask, DoubleRegister ifTrue, DoubleRegister ifFalse)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_blendv_pd(ifFalse, ifTrue, mask);
+
+#elif SSE_INSTR_SET > 4
+			return DoubleRegister{ _mm_blendv_pd(ifFalse.xy, ifTrue.xy, mask.xy), _mm_blendv_pd(ifFalse.zw, ifTrue.zw, mask.zw) };
+
+#else
+			return DoubleRegister{
+				_mm_or_pd(_mm_and_pd(mask.xy, ifTrue.xy), _mm_andnot_pd(mask.xy, ifFalse.xy)),
+				_mm_or_pd(_mm_and_pd(mask.zw, ifTrue.zw), _mm_andnot_pd(mask.zw, ifFalse.zw)) };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Get the lane bits of a double compare result. Bit n is set when lane n is true.
+		 *
+		 * @param value: The compare result.
+		 * @return The lane bits.
+		 */
+		inline int MoveMask(DoubleRegister value)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_movemask_pd(value);
+
+#else
+			return _mm_movemask_pd(value.xy) | (_mm_movemask_pd(value.zw) << 2);
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Sum all four lanes of a double register.
+		 *
+		 * @param value: The register to reduce.
+		 * @return The sum, splatted to all four lanes.
+		 */
+		inline DoubleRegister HorizontalSum(DoubleRegister value)
+		{
+#if SSE_INSTR_SET > 6
+			const __m256d sum = _mm256_hadd_pd(value, value);
+			return _mm256_add_pd(sum, _mm256_permute2f128_pd(sum, sum, 0x01));
+
+#else
+			__m128d sum = _mm_add_pd(value.xy, value.zw);
+			sum = _mm_add_pd(sum, _mm_shuffle_pd(sum, sum, 0x01));
+			return DoubleRegister{ sum, sum };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Compute the dot product of the x, y and z lanes of two double registers.
+		 * The w lanes are ignored.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The dot product, splatted to all four lanes.
+		 */
+		inline DoubleRegister Dot3(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return HorizontalSum(_mm256_blend_pd(_mm256_mul_pd(lhs, rhs), _mm256_setzero_pd(), 0x8));
+
+#else
+			return HorizontalSum(DoubleRegister{ _mm_mul_pd(lhs.xy, rhs.xy), _mm_move_sd(_mm_setzero_pd(), _mm_mul_pd(lhs.zw, rhs.zw)) });
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Compute the dot product of all four lanes of two double registers.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The dot product, splatted to all four lanes.
+		 */
+		inline DoubleRegister Dot4(DoubleRegister lhs, DoubleRegister rhs)
+		{
+			return HorizontalSum(Mul(lhs, rhs));
+		}
+
+		/**
+		 * Get the first lane of a double register.
+		 *
+		 * @param value: The double register.
+		 * @return The x lane.
+		 */
+		inline double FirstLane(DoubleRegister value)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm_cvtsd_f64(_mm256_castpd256_pd128(value));
+
+#else
+			return _mm_cvtsd_f64(value.xy);
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Broadcast one lane of a double register to all four lanes.
+		 *
+		 * @tparam Lane: The lane to broadcast.
+		 * @param value: The register.
+		 * @return The splatted lane.
+		 */
+		template<int Lane>
+		inline DoubleRegister Splat(DoubleRegister value)
+		{
+#if SSE_INSTR_SET > 7
+			return _mm256_permute4x64_pd(value, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+
+#elif SSE_INSTR_SET > 6
+			const __m256d half = _mm256_permute2f128_pd(value, value, Lane < 2 ? 0x00 : 0x11);
+			return _mm256_permute_pd(half, Lane & 1 ? 0xF : 0x0);
+
+#else
+			const __m128d half = Lane < 2 ? value.xy : value.zw;
+			const __m128d lane = _mm_shuffle_pd(half, half, Lane & 1 ? 0x3 : 0x0);
+			return DoubleRegister{ lane, lane };
+
+#endif // SSE_INSTR_SET > 7
+		}
+
+		/**
+		 * Rotate the x, y and z lanes of a double register to (y, z, x, w).
+		 *
+		 * @param value: The register.
+		 * @return The rotated register.
+		 */
+		inline DoubleRegister ShuffleYZX(DoubleRegister value)
+		{
+#if SSE_INSTR_SET > 7
+			return _mm256_permute4x64_pd(value, _MM_SHUFFLE(3, 0, 2, 1));
+
+#elif SSE_INSTR_SET > 6
+			// AVX has no cross lane double shuffle: (y, z, -, -) and (-, -, x, w) are picked from the register and its swapped halves.
+			const __m256d swapped = _mm256_permute2f128_pd(value, value, 0x01);
+			return _mm256_blend_pd(_mm256_shuffle_pd(value, swapped, 0x1), _mm256_shuffle_pd(swapped, value, 0x8), 0xC);
+
+#else
+			return DoubleRegister{ _mm_shuffle_pd(value.xy, value.zw, 0x1), _mm_move_sd(value.zw, value.xy) };
+
+#endif // SSE_INSTR_SET > 7
+		}
+
+		/**
+		 * Compute the cross product of the x, y and z lanes of two double registers.
+		 * The w lane of the result is lhs.w * rhs.w - rhs.w * lhs.w, which is 0 for finite inputs.
+		 *
+		 * @param lhs: The LHS register.
+		 * @param rhs: The RHS register.
+		 * @return The cross product.
+		 */
+		inline DoubleRegister Cross3(DoubleRegister lhs, DoubleRegister rhs)
+		{
+			// The same form as the single precision Cross3.
+			return ShuffleYZX(MulSub(lhs, ShuffleYZX(rhs), Mul(ShuffleYZX(lhs), rhs)));
+		}
+
+		/**
+		 * Transpose four double registers, as the rows of a 4x4 matrix.
+		 *
+		 * @param row0: The first row.
+		 * @param row1: The second row.
+		 * @param row2: The third row.
+		 * @param row3: The fourth row.
+		 */
+		inline void Transpose4(DoubleRegister& row0, DoubleRegister& row1, DoubleRegister& row2, DoubleRegister& row3)
+		{
+#if SSE_INSTR_SET > 6
+			const __m256d xz01 = _mm256_unpacklo_pd(row0, row1);
+			const __m256d yw01 = _mm256_unpackhi_pd(row0, row1);
+			const __m256d xz23 = _mm256_unpacklo_pd(row2, row3);
+			const __m256d yw23 = _mm256_unpackhi_pd(row2, row3);
+
+			row0 = _mm256_permute2f128_pd(xz01, xz23, 0x20);
+			row1 = _mm256_permute2f128_pd(yw01, yw23, 0x20);
+			row2 = _mm256_permute2f128_pd(xz01, xz23, 0x31);
+			row3 = _mm256_permute2f128_pd(yw01, yw23, 0x31);
+
+#else
+			const DoubleRegister column0 = { _mm_unpacklo_pd(row0.xy, row1.xy), _mm_unpacklo_pd(row2.xy, row3.xy) };
+			const DoubleRegister column1 = { _mm_unpackhi_pd(row0.xy, row1.xy), _mm_unpackhi_pd(row2.xy, row3.xy) };
+			const DoubleRegister column2 = { _mm_unpacklo_pd(row0.zw, row1.zw), _mm_unpacklo_pd(row2.zw, row3.zw) };
+			const DoubleRegister column3 = { _mm_unpackhi_pd(row0.zw, row1.zw), _mm_unpackhi_pd(row2.zw, row3.zw) };
+
+			row0 = column0;
+			row1 = column1;
+			row2 = column2;
+			row3 = column3;
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Rearrange the lanes of a double register.
+		 *
+		 * @tparam Lane0: The source lane of the x lane.
+		 * @tparam Lane1: The source lane of the y lane.
+		 * @tparam Lane2: The source lane of the z lane.
+		 * @tparam Lane3: The source lane of the w lane.
+		 * @param value: The register.
+		 * @return The rearranged register.
+		 */
+		template<int Lane0, int Lane1, int Lane2, int Lane3>
+		inline DoubleRegister Permute(DoubleRegister value)
+		{
+#if SSE_INSTR_SET > 7
+			return _mm256_permute4x64_pd(value, _MM_SHUFFLE(Lane3, Lane2, Lane1, Lane0));
+
+#elif SSE_INSTR_SET > 6
+			// AVX only permutes within the 128 bit halves, so the lanes which come from the other half are blended in from the
+			// register with its halves swapped.
+			constexpr int inHalf = (Lane0 & 1) | ((Lane1 & 1) << 1) | ((Lane2 & 1) << 2) | ((Lane3 & 1) << 3);
+			constexpr int otherHalf = (Lane0 >> 1) | ((Lane1 >> 1) << 1) | ((1 - (Lane2 >> 1)) << 2) | ((1 - (Lane3 >> 1)) << 3);
+
+			const __m256d swapped = _mm256_permute2f128_pd(value, value, 0x01);
+			return _mm256_blend_pd(_mm256_permute_pd(value, inHalf), _mm256_permute_pd(swapped, inHalf), otherHalf);
+
+#else
+			return DoubleRegister{
+				_mm_shuffle_pd(Lane0 < 2 ? value.xy : value.zw, Lane1 < 2 ? value.xy : value.zw, (Lane0 & 1) | ((Lane1 & 1) << 1)),
+				_mm_shuffle_pd(Lane2 < 2 ? value.xy : value.zw, Lane3 < 2 ? value.xy : value.zw, (Lane2 & 1) | ((Lane3 & 1) << 1)) };
+
+#endif // SSE_INSTR_SET > 7
+		}
+
+		/**
+		 * Combine the x and y lanes of two double registers, like _mm_movelh_ps.
+		 *
+		 * @param lhs: The register which gives the x and y lanes.
+		 * @param rhs: The register which gives the z and w lanes.
+		 * @return (lhs.x, lhs.y, rhs.x, rhs.y).
+		 */
+		inline DoubleRegister MoveLowHalves(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_permute2f128_pd(lhs, rhs, 0x20);
+
+#else
+			return DoubleRegister{ lhs.xy, rhs.xy };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Combine the z and w lanes of two double registers.
+		 *
+		 * @param lhs: The register which gives the x and y lanes.
+		 * @param rhs: The register which gives the z and w lanes.
+		 * @return (lhs.z, lhs.w, rhs.z, rhs.w).
+		 */
+		inline DoubleRegister MoveHighHalves(DoubleRegister lhs, DoubleRegister rhs)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_permute2f128_pd(lhs, rhs, 0x31);
+
+#else
+			return DoubleRegister{ lhs.zw, rhs.zw };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Take the x and y lanes of one double register and the z and w lanes of another.
+		 *
+		 * @param low: The register which gives the x and y lanes.
+		 * @param high: The register which gives the z and w lanes.
+		 * @return (low.x, low.y, high.z, high.w).
+		 */
+		inline DoubleRegister SelectHalves(DoubleRegister low, DoubleRegister high)
+		{
+#if SSE_INSTR_SET > 6
+			return _mm256_blend_pd(low, high, 0xC);
+
+#else
+			return DoubleRegister{ low.xy, high.zw };
+
+#endif // SSE_INSTR_SET > 6
+		}
+
+		/**
+		 * Compute the reciprocal lengths of four double rows, like the single precision InverseRowLengths.
+		 *
+		 * @param row0: The first row.
+		 * @param row1: The second row.
+		 * @param row2: The third row.
+		 * @param row3: The fourth row.
+		 * @return The reciprocal lengths, one row per lane.
+		 */
+		inline DoubleRegister InverseRowLengths(DoubleRegister row0, DoubleRegister row1, DoubleRegister row2, DoubleRegister row3)
+		{
+			row0 = Mul(row0, row0);
+			row1 = Mul(row1, row1);
+			row2 = Mul(row2, row2);
+			row3 = Mul(row3, row3);
+			Transpose4(row0, row1, row2, row3);
+
+			return Div(Set1Double(1.0), Sqrt(Add(Add(row0, row1), Add(row2, row3))));
+		}
+
+		/**
+		 * Check whether the determinant of a double matrix with unit length rows is large enough to invert the matrix with, like
+		 * the single precision IsInvertible.
+		 *
+		 * @param determinant: The determinant of the row normalized matrix, in the first lane.
+		 * @param tolerance: The relative tolerance.
+		 * @return True if the matrix can be inverted.
+		 */
+		inline bool IsInvertible(DoubleRegister determinant, double tolerance)
+		{
+			const double magnitude = std::fabs(FirstLane(determinant));
+			return magnitude > tolerance && magnitude < std::numeric_limits<double>::infinity();
+		}
+
+		/**
+		 * Check whether all the lanes of four double registers are finite.
+		 *
+		 * @param value0: The first register.
+		 * @param value1: The second register.
+		 * @param value2: The third register.
+		 * @param value3: The fourth register.
+		 * @return True if no lane is an infinity or a NaN.
+		 */
+		inline bool AllFinite(DoubleRegister value0, DoubleRegister value1, DoubleRegister value2, DoubleRegister value3)
+		{
+			// x * 0 is 0 for finite x and NaN for infinities and NaNs, and a NaN survives the sums.
+			const DoubleRegister zero = Set1Double(0.0);
+			const DoubleRegister sum = Add(Add(Mul(value0, zero), Mul(value1, zero)), Add(Mul(value2, zero), Mul(value3, zero)));
+
+			return MoveMask(CompareEqual(sum, sum)) == 0xF;
+		}
+	}
+}
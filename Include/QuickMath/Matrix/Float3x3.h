@@ -0,0 +1,86 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Matrix33.h"
+#include "../Vector/Float3.h"
+
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * Packed 3x3 matrix for QuickMath.
+	 * This is a storage type of three Float3 rows (36 bytes instead of the 48 of a Matrix33), for arrays which are stored or sent as is.
+	 * Convert to a Matrix33 to do math with it. The rows of consecutive matrices are contiguous in both types, so the bulk conversions
+	 * go through the Float3 ones.
+	 */
+	class Float3x3 final
+	{
+	public:
+		Float3x3() = default;
+
+		/**
+		 * Construct the matrix without initializing it.
+		 */
+		explicit Float3x3(UninitializedTag tag) : r(tag), g(tag), b(tag) {}
+
+		/**
+		 * Construct the matrix using 3 rows.
+		 *
+		 * @param vec1: Row one.
+		 * @param vec2: Row two.
+		 * @param vec3: Row three.
+		 */
+		Float3x3(const Float3& vec1, const Float3& vec2, const Float3& vec3) : r(vec1), g(vec2), b(vec3) {}
+
+		/**
+		 * Construct the matrix using a Matrix33.
+		 *
+		 * @param matrix: The matrix.
+		 */
+		explicit Float3x3(const Matrix33& matrix) : r(matrix.r), g(matrix.g), b(matrix.b) {}
+
+		/**
+		 * Convert the matrix to a Matrix33.
+		 *
+		 * @return The matrix.
+		 */
+		Matrix33 ToMatrix33() const
+		{
+			return Matrix33(r.ToVector3(), g.ToVector3(), b.ToVector3());
+		}
+
+		/**
+		 * Pack an array of Matrix33s.
+		 *
+		 * @param input: The input matrices.
+		 * @param output: The packed matrices.
+		 * @param count: The number of matrices.
+		 */
+		static void Pack(const Matrix33* input, Float3x3* output, size_t count)
+		{
+			Float3::Pack(&input->r, &output->r, count * 3);
+		}
+
+		/**
+		 * Unpack an array of matrices to Matrix33s. The w components of the rows are 0.
+		 *
+		 * @param input: The packed matrices.
+		 * @param output: The output matrices.
+		 * @param count: The number of matrices.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		static void Unpack(const Float3x3* input, Matrix33* output, size_t count, StoreMode mode = StoreMode::Cached)
+		{
+			Float3::Unpack(&input->r, &output->r, count * 3, mode);
+		}
+
+	public:
+		Float3 r, g, b;
+	};
+
+	static_assert(sizeof(Float3x3) == 36, "Invalid Float3x3 size.");
+	static_assert(alignof(Float3x3) == 4, "Invalid Float3x3 alignment.");
+	static_assert(std::is_trivially_copyable<Float3x3>::value, "Float3x3 must be trivially copyable.");
+}
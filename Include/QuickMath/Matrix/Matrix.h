@@ -7,6 +7,7 @@ namespace QuickMath
 	/**
 	 * Matrix data type for QuickMath.
 	 * This class contains all the common methods and operators all the other matrices contain.
+	 * Like the vector base, it has no copy operations of its own, so the matrices stay trivially copyable.
 	 *
 	 * @tparam Type: Matrix type.
 	 * @tparam ValueType: The primitive value type.
@@ -101,14 +102,6 @@ namespace QuickMath
 			return (*this)();
 		}
 
-		/**
-		 * Return this matrix.
-		 *
-		 * @param :
-		 * @return This matrix.
-		 */
-		Matrix& operator=(const  Matrix&) { return *this; }
-
 		/**
 		 * Initialize as an identity matrix.
 		 */
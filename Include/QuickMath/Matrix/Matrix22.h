@@ -5,22 +5,30 @@
 #include "Matrix.h"
 #include "../Vector/Vector2.h"
 
+#include <type_traits>
+
 namespace QuickMath
 {
 	/**
 	 * Matrix 2x2 for QuickMath.
+	 * Both rows are packed into a single SSE register (x.x, x.y, y.x, y.y).
 	 */
 	class Matrix22 final : public Matrix<Matrix22, float>
 	{
 	public:
-		Matrix22() : x(0.0f), y(0.0f) {}
+		Matrix22() : intrinsic(_mm_setzero_ps()) {}
+
+		/**
+		 * Construct the matrix without initializing it.
+		 */
+		explicit Matrix22(UninitializedTag) {}
 
 		/**
 		 * Construct the matrix using one value.
 		 *
 		 * @param value: The value to be constructed with.
 		 */
-		Matrix22(float value) :x(value, 0.0f), y(0.0f, value) {}
+		Matrix22(float value) : intrinsic(_mm_setr_ps(value, 0.0f, 0.0f, value)) {}
 
 		/**
 		 * Set values to the matrix using two 2D vectors.
@@ -28,7 +36,7 @@ namespace QuickMath
 		 * @param vec1: Vector one.
 		 * @param vec2: Vector two.
 		 */
-		Matrix22(Vector2 vec1, Vector2 vec2) : x(vec1), y(vec2) {}
+		Matrix22(Vector2 vec1, Vector2 vec2) : intrinsic(_mm_movelh_ps(vec1, vec2)) {}
 
 		/**
 		 * Construct the matrix by setting individual values.
@@ -40,14 +48,21 @@ namespace QuickMath
 		 */
 		Matrix22(
 			float a, float b,
-			float c, float d) : x(a, b), y(c, d) {}
+			float c, float d) : intrinsic(_mm_setr_ps(a, b, c, d)) {}
+
+		/**
+		 * Construct the matrix using an intrinsic value.
+		 *
+		 * @param intrinsic: The intrinsic value holding both rows.
+		 */
+		Matrix22(const IntrinsicTraits<float, 4>::Type& intrinsic) : intrinsic(intrinsic) {}
 
 		/**
 		 * Construct the matrix using an initializer list.
 		 *
 		 * @param list: The initializer list.
 		 */
-		Matrix22(std::initializer_list<float> list) : x(0.0f), y(0.0f)
+		Matrix22(std::initializer_list<float> list) : intrinsic(_mm_setzero_ps())
 		{
 			if ((list.size() > 4) || (list.size() < 4))
 				return;
@@ -83,13 +98,9 @@ namespace QuickMath
 		 * @param other: The other matrix.
 		 * @return The new matrix.
 		 */
-		Matrix22 operator+(const Matrix22& other)
+		Matrix22 operator+(const Matrix22& other) const
 		{
-			Matrix22 newMatrix = Matrix22::Identity;
-			newMatrix.x = x + other.x;
-			newMatrix.y = y + other.y;
-
-			return newMatrix;
+			return Matrix22(_mm_add_ps(intrinsic, other.intrinsic));
 		}
 
 		/**
@@ -98,13 +109,9 @@ namespace QuickMath
 		 * @param other: The other matrix.
 		 * @return The new matrix.
 		 */
-		Matrix22 operator-(const Matrix22& other)
+		Matrix22 operator-(const Matrix22& other) const
 		{
-			Matrix22 newMatrix = Matrix22::Identity;
-			newMatrix.x = x - other.x;
-			newMatrix.y = y - other.y;
-
-			return newMatrix;
+			return Matrix22(_mm_sub_ps(intrinsic, other.intrinsic));
 		}
 
 		/**
@@ -113,13 +120,9 @@ namespace QuickMath
 		 * @param value: The value to be multiplied with.
 		 * @return The multiplied matrix.
 		 */
-		Matrix22 operator*(const float& value)
+		Matrix22 operator*(const float& value) const
 		{
-			Matrix22 newMatrix = Matrix22::Identity;
-			newMatrix.r = r * value;
-			newMatrix.g = g * value;
-
-			return newMatrix;
+			return Matrix22(_mm_mul_ps(intrinsic, _mm_set1_ps(value)));
 		}
 
 		/**
@@ -129,9 +132,21 @@ namespace QuickMath
 		 * @param other: The vector 2D.
 		 * @return The multiplied vector 2D.
 		 */
-		Vector2 operator*(const Vector2& other)
+		Vector2 operator*(const Vector2& other) const
 		{
-			return { (r[0] * other[0]) + (r[1] * other[1]), (g[0] * other[0]) + (g[1] * other[1]) };
+			const IntrinsicTraits<float, 2>::Type vector = other;
+			const IntrinsicTraits<float, 4>::Type product = _mm_mul_ps(intrinsic, _mm_movelh_ps(vector, vector));
+
+			// Add the pairs (x.x * v.x + x.y * v.y, y.x * v.x + y.y * v.y) into the low half.
+#if SSE_INSTR_SET > 2
+			return _mm_hadd_ps(product, product);
+
+#else
+			return _mm_add_ps(
+				_mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 0, 2, 0)),
+				_mm_shuffle_ps(product, product, _MM_SHUFFLE(3, 1, 3, 1)));
+
+#endif // SSE_INSTR_SET > 2
 		}
 
 		/**
@@ -140,13 +155,15 @@ namespace QuickMath
 		 * @param other: The other matrix to be multiplied with.
 		 * @return The multiplied matrix.
 		 */
-		Matrix22 operator*(const Matrix22& other)
+		Matrix22 operator*(const Matrix22& other) const
 		{
-			Matrix22 newMatrix = Matrix22::Identity;
-			newMatrix.r = (x * other[0][0]) + (y * other[0][1]);
-			newMatrix.g = (x * other[1][0]) + (y * other[1][1]);
+			// Both rows at once: r = x * other[0][0] + y * other[0][1], g = x * other[1][0] + y * other[1][1].
+			const IntrinsicTraits<float, 4>::Type rowX = _mm_movelh_ps(intrinsic, intrinsic);
+			const IntrinsicTraits<float, 4>::Type rowY = _mm_movehl_ps(intrinsic, intrinsic);
+			const IntrinsicTraits<float, 4>::Type scaleX = _mm_shuffle_ps(other.intrinsic, other.intrinsic, _MM_SHUFFLE(2, 2, 0, 0));
+			const IntrinsicTraits<float, 4>::Type scaleY = _mm_shuffle_ps(other.intrinsic, other.intrinsic, _MM_SHUFFLE(3, 3, 1, 1));
 
-			return newMatrix;
+			return Matrix22(Intrinsics::MulAdd(rowY, scaleY, _mm_mul_ps(rowX, scaleX)));
 		}
 
 		/**
@@ -155,13 +172,9 @@ namespace QuickMath
 		 * @param value: The value to be multiplied with.
 		 * @return The divided matrix.
 		 */
-		Matrix22 operator/(const float& value)
+		Matrix22 operator/(const float& value) const
 		{
-			Matrix22 newMatrix = Matrix22::Identity;
-			newMatrix.r = r / value;
-			newMatrix.g = g / value;
-
-			return newMatrix;
+			return Matrix22(_mm_div_ps(intrinsic, _mm_set1_ps(value)));
 		}
 
 		/**
@@ -171,7 +184,7 @@ namespace QuickMath
 		 */
 		Matrix22 Transpose() const
 		{
-			return Matrix22(x.x, y.x, x.y, y.y);
+			return Matrix22(_mm_shuffle_ps(intrinsic, intrinsic, _MM_SHUFFLE(3, 1, 2, 0)));
 		}
 
 		/**
@@ -181,7 +194,20 @@ namespace QuickMath
 		 */
 		float Determinant() const
 		{
-			return (x.x * y.y) - (x.y * y.x);
+			return _mm_cvtss_f32(DeterminantSplat());
+		}
+
+		/**
+		 * Get the determinant of the matrix, splatted to all four lanes.
+		 *
+		 * @return The splatted determinant.
+		 */
+		IntrinsicTraits<float, 4>::Type DeterminantSplat() const
+		{
+			// (x.x * y.y, x.y * y.x, y.x * x.y, y.y * x.x)
+			const IntrinsicTraits<float, 4>::Type product = _mm_mul_ps(intrinsic, _mm_shuffle_ps(intrinsic, intrinsic, _MM_SHUFFLE(0, 1, 2, 3)));
+			const IntrinsicTraits<float, 4>::Type determinant = _mm_sub_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+			return _mm_shuffle_ps(determinant, determinant, _MM_SHUFFLE(0, 0, 0, 0));
 		}
 
 		/**
@@ -191,7 +217,9 @@ namespace QuickMath
 		 */
 		Matrix22 Adjugate() const
 		{
-			return Matrix22(y.y, -x.y, -y.x, x.x);
+			// (y.y, -x.y, -y.x, x.x)
+			const IntrinsicTraits<float, 4>::Type signs = _mm_setr_ps(0.0f, -0.0f, -0.0f, 0.0f);
+			return Matrix22(_mm_xor_ps(_mm_shuffle_ps(intrinsic, intrinsic, _MM_SHUFFLE(0, 2, 1, 3)), signs));
 		}
 
 		/**
@@ -201,8 +229,7 @@ namespace QuickMath
 		 */
 		Matrix22 Inverse() const
 		{
-			float a = 1.0f / Determinant();
-			return Adjugate() * a;
+			return Matrix22(_mm_div_ps(Adjugate().intrinsic, DeterminantSplat()));
 		}
 
 	public:
@@ -217,6 +244,12 @@ namespace QuickMath
 			{
 				Vector2 r, g;
 			};
+
+			IntrinsicTraits<float, 4>::Type intrinsic;
 		};
 	};
+
+	static_assert(sizeof(Matrix22) == 16, "Invalid Matrix22 size.");
+	static_assert(alignof(Matrix22) == 16, "Invalid Matrix22 alignment.");
+	static_assert(std::is_trivially_copyable<Matrix22>::value, "Matrix22 must be trivially copyable.");
 }
@@ -5,10 +5,11 @@
 #include "Matrix.h"
 #include "../Vector/Vector3.h"
 
+#include <cstddef>
+#include <type_traits>
+
 namespace QuickMath
 {
-	class Matrix22;
-
 	/**
 	 * Matrix 3x3 for QuickMath.
 	 */
@@ -17,6 +18,11 @@ namespace QuickMath
 	public:
 		Matrix33() : r(0.0f), g(0.0f), b(0.0f) {}
 
+		/**
+		 * Construct the matrix without initializing it.
+		 */
+		explicit Matrix33(UninitializedTag tag) : r(tag), g(tag), b(tag) {}
+
 		/**
 		 * Construct the matrix using one value.
 		 *
@@ -96,14 +102,9 @@ namespace QuickMath
 		 * @param other: The other matrix.
 		 * @return The new matrix.
 		 */
-		Matrix33 operator+(const Matrix33& other)
+		Matrix33 operator+(const Matrix33& other) const
 		{
-			Matrix33 newMatrix = Matrix33::Identity;
-			newMatrix.x = x + other.x;
-			newMatrix.y = y + other.y;
-			newMatrix.z = z + other.z;
-
-			return newMatrix;
+			return Matrix33(r + other.r, g + other.g, b + other.b);
 		}
 
 		/**
@@ -112,14 +113,9 @@ namespace QuickMath
 		 * @param other: The other matrix.
 		 * @return The new matrix.
 		 */
-		Matrix33 operator-(const Matrix33& other)
+		Matrix33 operator-(const Matrix33& other) const
 		{
-			Matrix33 newMatrix = Matrix33::Identity;
-			newMatrix.x = x - other.x;
-			newMatrix.y = y - other.y;
-			newMatrix.z = z - other.z;
-
-			return newMatrix;
+			return Matrix33(r - other.r, g - other.g, b - other.b);
 		}
 
 		/**
@@ -128,14 +124,10 @@ namespace QuickMath
 		 * @param value: The value to be multiplied with.
 		 * @return The multiplied matrix.
 		 */
-		Matrix33 operator*(const float& value)
+		Matrix33 operator*(const float& value) const
 		{
-			Matrix33 newMatrix = Matrix33::Identity;
-			newMatrix.r = r * value;
-			newMatrix.g = g * value;
-			newMatrix.b = b * value;
-
-			return newMatrix;
+			const IntrinsicTraits<float, 3>::Type scale = _mm_set1_ps(value);
+			return Matrix33(_mm_mul_ps(r.intrinsic, scale), _mm_mul_ps(g.intrinsic, scale), _mm_mul_ps(b.intrinsic, scale));
 		}
 
 		/**
@@ -145,13 +137,15 @@ namespace QuickMath
 		 * @param other: The vector 3D.
 		 * @return The multiplied vector 3D.
 		 */
-		Vector3 operator*(const Vector3& other)
+		Vector3 operator*(const Vector3& other) const
 		{
-			return {
-				(r[0] * other[0]) + (r[1] * other[1]) + (r[2] * other[2]),
-				(g[0] * other[0]) + (g[1] * other[1]) + (g[2] * other[2]),
-				(b[0] * other[0]) + (b[1] * other[1]) + (b[2] * other[2])
-			};
+			// Transpose the rows into columns and combine them with the broadcast lanes of the vector.
+			IntrinsicTraits<float, 3>::Type column0 = r.intrinsic, column1 = g.intrinsic, column2 = b.intrinsic, column3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+
+			const IntrinsicTraits<float, 3>::Type vector = other.intrinsic;
+			return Intrinsics::MulAdd(column2, Intrinsics::Splat<2>(vector),
+				Intrinsics::MulAdd(column1, Intrinsics::Splat<1>(vector), _mm_mul_ps(column0, Intrinsics::Splat<0>(vector))));
 		}
 
 		/**
@@ -160,14 +154,9 @@ namespace QuickMath
 		 * @param other: The other matrix to be multiplied with.
 		 * @return The multiplied matrix.
 		 */
-		Matrix33 operator*(const Matrix33& other)
+		Matrix33 operator*(const Matrix33& other) const
 		{
-			Matrix33 newMatrix = Matrix33::Identity;
-			newMatrix.r = (r * other[0][0]) + (g * other[0][1]) + (b * other[0][2]);
-			newMatrix.g = (r * other[1][0]) + (g * other[1][1]) + (b * other[1][2]);
-			newMatrix.b = (r * other[2][0]) + (g * other[2][1]) + (b * other[2][2]);
-
-			return newMatrix;
+			return Matrix33(CombineRows(other.r.intrinsic), CombineRows(other.g.intrinsic), CombineRows(other.b.intrinsic));
 		}
 
 		/**
@@ -176,14 +165,10 @@ namespace QuickMath
 		 * @param value: The value to be multiplied with.
 		 * @return The divided matrix.
 		 */
-		Matrix33 operator/(const float& value)
+		Matrix33 operator/(const float& value) const
 		{
-			Matrix33 newMatrix = Matrix33::Identity;
-			newMatrix.r = r / value;
-			newMatrix.g = g / value;
-			newMatrix.b = b / value;
-
-			return newMatrix;
+			const IntrinsicTraits<float, 3>::Type divisor = _mm_set1_ps(value);
+			return Matrix33(_mm_div_ps(r.intrinsic, divisor), _mm_div_ps(g.intrinsic, divisor), _mm_div_ps(b.intrinsic, divisor));
 		}
 
 		/**
@@ -193,54 +178,197 @@ namespace QuickMath
 		 */
 		Matrix33 Transpose() const
 		{
-			return Matrix33(x.x, y.x, z.x, x.y, y.y, z.y, x.z, y.z, z.z);
+			IntrinsicTraits<float, 3>::Type row0 = r.intrinsic, row1 = g.intrinsic, row2 = b.intrinsic, row3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+			return Matrix33(row0, row1, row2);
+		}
+
+		/**
+		 * Transpose the matrix straight into a buffer, such as a GPU upload buffer.
+		 * The rows are padded to 4 floats (12 floats in total, the std140 layout of a mat3), with 0 in the padding.
+		 *
+		 * @param destination: The destination. It must be 16 byte aligned for non-temporal stores.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		void TransposeStore(float* destination, StoreMode mode = StoreMode::Cached) const
+		{
+			TransposeStore(this, destination, 1, mode);
+		}
+
+		/**
+		 * Transpose an array of matrices.
+		 * The output may be the same array as the input.
+		 *
+		 * @param input: The input matrices.
+		 * @param output: The transposed matrices.
+		 * @param count: The number of matrices.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		static void Transpose(const Matrix33* input, Matrix33* output, size_t count, StoreMode mode = StoreMode::Cached)
+		{
+			TransposeStore(input, &output->r.x, count, mode);
+		}
+
+		/**
+		 * Transpose an array of matrices straight into a buffer (12 floats per matrix, as in TransposeStore), such as a GPU upload buffer.
+		 * The destination may be the input array itself.
+		 *
+		 * @param input: The input matrices.
+		 * @param destination: The destination. It must be 16 byte aligned for non-temporal stores.
+		 * @param count: The number of matrices.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		static void TransposeStore(const Matrix33* input, float* destination, size_t count, StoreMode mode = StoreMode::Cached)
+		{
+			if (mode == StoreMode::NonTemporal)
+			{
+				TransposeLoop<StoreMode::NonTemporal>(input, destination, count);
+				_mm_sfence();
+			}
+			else
+				TransposeLoop<StoreMode::Cached>(input, destination, count);
 		}
 
 		/**
 		 * Get the determinant of the matrix.
+		 * This is the triple product r . (g x b).
 		 *
 		 * @return The determinant value.
 		 */
 		float Determinant() const
 		{
-			float a = x.x * Matrix22(y.y, y.z, z.y, z.z).Determinant();
-			float b = x.y * Matrix22(y.x, y.z, z.x, z.z).Determinant();
-			float c = x.z * Matrix22(y.x, y.y, z.x, z.y).Determinant();
-
-			return a - b + c;
+			return _mm_cvtss_f32(Intrinsics::Dot3(r.intrinsic, Intrinsics::Cross3(g.intrinsic, b.intrinsic)));
 		}
 
 		/**
 		 * Get the adjugate matrix of the current matrix (Adj(x)).
+		 * The columns of the adjugate are the cross products of the row pairs.
 		 *
 		 * @return The matrix.
 		 */
 		Matrix33 Adjugate() const
 		{
-			float a = Matrix22(y.y, y.z, z.y, z.z).Determinant();
-			float b = -Matrix22(x.y, x.z, z.y, z.z).Determinant();
-			float c = Matrix22(x.y, x.z, y.y, y.z).Determinant();
-
-			float d = -Matrix22(y.x, y.z, z.x, z.z).Determinant();
-			float e = Matrix22(x.x, x.z, z.x, z.z).Determinant();
-			float f = -Matrix22(x.x, x.z, y.x, y.z).Determinant();
-
-			float g = Matrix22(y.x, y.y, z.x, z.y).Determinant();
-			float h = -Matrix22(x.x, x.y, z.x, z.y).Determinant();
-			float i = Matrix22(x.x, x.y, y.x, y.y).Determinant();
+			IntrinsicTraits<float, 3>::Type column0 = Intrinsics::Cross3(g.intrinsic, b.intrinsic);
+			IntrinsicTraits<float, 3>::Type column1 = Intrinsics::Cross3(b.intrinsic, r.intrinsic);
+			IntrinsicTraits<float, 3>::Type column2 = Intrinsics::Cross3(r.intrinsic, g.intrinsic);
+			IntrinsicTraits<float, 3>::Type column3 = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(column0, column1, column2, column3);
 
-			return Matrix33(a, b, c, d, e, f, g, h, i);
+			return Matrix33(column0, column1, column2);
 		}
 
 		/**
 		 * Get the inverse matrix of the current matrix.
+		 * The result is not finite when the matrix is singular.
 		 *
 		 * @return The inverse matrix.
 		 */
 		Matrix33 Inverse() const
 		{
-			float a = 1.0f / Determinant();
-			return Adjugate() * a;
+			Matrix33 inverse(Uninitialized);
+			InverseUnchecked(inverse);
+			return inverse;
+		}
+
+		/**
+		 * Get the inverse matrix of the current matrix.
+		 * The rows are scaled to unit length before the determinant is formed, and the matrix is taken as singular when the
+		 * determinant of that is <= tolerance, or when the inverse is not finite, like Matrix44::Inverse. The result is left
+		 * untouched then.
+		 *
+		 * @param result: The matrix to store the inverse to.
+		 * @param tolerance: The relative tolerance. Default is DefaultInverseTolerance.
+		 * @return False if the matrix is singular.
+		 */
+		bool Inverse(Matrix33& result, float tolerance = DefaultInverseTolerance) const
+		{
+			const __m128 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+			const __m128 inverseLengths = Intrinsics::InverseRowLengths(
+				_mm_and_ps(r.intrinsic, mask), _mm_and_ps(g.intrinsic, mask), _mm_and_ps(b.intrinsic, mask), _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+			const Matrix33 normalized(
+				_mm_mul_ps(r.intrinsic, Intrinsics::Splat<0>(inverseLengths)),
+				_mm_mul_ps(g.intrinsic, Intrinsics::Splat<1>(inverseLengths)),
+				_mm_mul_ps(b.intrinsic, Intrinsics::Splat<2>(inverseLengths)));
+
+			Matrix33 inverse(Uninitialized);
+			if (!Intrinsics::IsInvertible(normalized.InverseUnchecked(inverse), tolerance))
+				return false;
+
+			// Scale the columns of the normalized inverse by the reciprocal lengths (the w lane of inverseLengths is 1).
+			const __m128 row0 = _mm_mul_ps(inverse.r.intrinsic, inverseLengths);
+			const __m128 row1 = _mm_mul_ps(inverse.g.intrinsic, inverseLengths);
+			const __m128 row2 = _mm_mul_ps(inverse.b.intrinsic, inverseLengths);
+			if (!Intrinsics::AllFinite(row0, row1, row2, _mm_setzero_ps()))
+				return false;
+
+			result.r = row0;
+			result.g = row1;
+			result.b = row2;
+			return true;
+		}
+
+	private:
+		/**
+		 * The batch transpose loop. The loop prefetches four matrices ahead.
+		 *
+		 * @tparam Mode: The store mode.
+		 * @param input: The input matrices.
+		 * @param destination: The destination.
+		 * @param count: The number of matrices.
+		 */
+		template<StoreMode Mode>
+		static void TransposeLoop(const Matrix33* input, float* destination, size_t count)
+		{
+			for (size_t index = 0; index < count; index++, destination += 12)
+			{
+				// Forming a pointer past the end of the array is undefined, so the last four matrices are not prefetched for.
+				if (index + 4 < count)
+					_mm_prefetch(reinterpret_cast<const char*>(input + index + 4), _MM_HINT_T0);
+
+				IntrinsicTraits<float, 3>::Type row0 = input[index].r.intrinsic, row1 = input[index].g.intrinsic, row2 = input[index].b.intrinsic;
+				IntrinsicTraits<float, 3>::Type row3 = _mm_setzero_ps();
+				_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+				Intrinsics::Store<Mode>(destination, row0);
+				Intrinsics::Store<Mode>(destination + 4, row1);
+				Intrinsics::Store<Mode>(destination + 8, row2);
+			}
+		}
+
+		/**
+		 * Compute the inverse without checking the determinant.
+		 *
+		 * @param result: The matrix to store the inverse to.
+		 * @return The determinant, splatted to all four lanes.
+		 */
+		IntrinsicTraits<float, 3>::Type InverseUnchecked(Matrix33& result) const
+		{
+			IntrinsicTraits<float, 3>::Type column0 = Intrinsics::Cross3(g.intrinsic, b.intrinsic);
+			IntrinsicTraits<float, 3>::Type column1 = Intrinsics::Cross3(b.intrinsic, r.intrinsic);
+			IntrinsicTraits<float, 3>::Type column2 = Intrinsics::Cross3(r.intrinsic, g.intrinsic);
+			IntrinsicTraits<float, 3>::Type column3 = _mm_setzero_ps();
+
+			const IntrinsicTraits<float, 3>::Type determinant = Intrinsics::Dot3(r.intrinsic, column0);
+			const IntrinsicTraits<float, 3>::Type inverseDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), determinant);
+			_MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+
+			result.r = _mm_mul_ps(column0, inverseDeterminant);
+			result.g = _mm_mul_ps(column1, inverseDeterminant);
+			result.b = _mm_mul_ps(column2, inverseDeterminant);
+			return determinant;
+		}
+
+		/**
+		 * Combine the rows using the lanes of a register as the weights (r * weights.x + g * weights.y + b * weights.z).
+		 *
+		 * @param weights: The weights register.
+		 * @return The combined row.
+		 */
+		IntrinsicTraits<float, 3>::Type CombineRows(IntrinsicTraits<float, 3>::Type weights) const
+		{
+			return Intrinsics::MulAdd(b.intrinsic, Intrinsics::Splat<2>(weights),
+				Intrinsics::MulAdd(g.intrinsic, Intrinsics::Splat<1>(weights), _mm_mul_ps(r.intrinsic, Intrinsics::Splat<0>(weights))));
 		}
 
 	public:
@@ -257,4 +385,8 @@ namespace QuickMath
 			};
 		};
 	};
+
+	static_assert(sizeof(Matrix33) == 48, "Invalid Matrix33 size.");
+	static_assert(alignof(Matrix33) == 16, "Invalid Matrix33 alignment.");
+	static_assert(std::is_trivially_copyable<Matrix33>::value, "Matrix33 must be trivially copyable.");
 }
@@ -3,12 +3,14 @@
 #pragma once
 
 #include "Matrix.h"
+#include "../Vector/Vector3.h"
 #include "../Vector/Vector4.h"
 
+#include <cstddef>
+#include <type_traits>
+
 namespace QuickMath
 {
-	class Matrix33;
-
 	/**
 	 * Matrix 4x4 for QuickMath.
 	 */
@@ -17,6 +19,11 @@ namespace QuickMath
 	public:
 		Matrix44() : r(0.0f), g(0.0f), b(0.0f), a(0.0f) {}
 
+		/**
+		 * Construct the matrix without initializing it.
+		 */
+		explicit Matrix44(UninitializedTag tag) : r(tag), g(tag), b(tag), a(tag) {}
+
 		/**
 		 * Construct the matrix using a value.
 		 *
@@ -107,14 +114,9 @@ namespace QuickMath
 		 * @param other: The other matrix.
 		 * @return The new matrix.
 		 */
-		Matrix44 operator+(const Matrix44& other)
+		Matrix44 operator+(const Matrix44& other) const
 		{
-			Matrix44 newMatrix = Matrix44::Identity;
-			newMatrix.x = x + other.x;
-			newMatrix.y = y + other.y;
-			newMatrix.z = z + other.z;
-
-			return newMatrix;
+			return Matrix44(r + other.r, g + other.g, b + other.b, a + other.a);
 		}
 
 		/**
@@ -123,14 +125,9 @@ namespace QuickMath
 		 * @param other: The other matrix.
 		 * @return The new matrix.
 		 */
-		Matrix44 operator-(const Matrix44& other)
+		Matrix44 operator-(const Matrix44& other) const
 		{
-			Matrix44 newMatrix = Matrix44::Identity;
-			newMatrix.x = x - other.x;
-			newMatrix.y = y - other.y;
-			newMatrix.z = z - other.z;
-
-			return newMatrix;
+			return Matrix44(r - other.r, g - other.g, b - other.b, a - other.a);
 		}
 
 		/**
@@ -139,15 +136,10 @@ namespace QuickMath
 		 * @param value: The value to be multiplied with.
 		 * @return The multiplied matrix.
 		 */
-		Matrix44 operator*(const float& value)
+		Matrix44 operator*(const float& value) const
 		{
-			Matrix44 newMatrix = Matrix44::Identity;
-			newMatrix.r = r * value;
-			newMatrix.g = g * value;
-			newMatrix.b = b * value;
-			newMatrix.a = a * value;
-
-			return newMatrix;
+			const IntrinsicTraits<float, 4>::Type scale = _mm_set1_ps(value);
+			return Matrix44(_mm_mul_ps(r.intrinsic, scale), _mm_mul_ps(g.intrinsic, scale), _mm_mul_ps(b.intrinsic, scale), _mm_mul_ps(a.intrinsic, scale));
 		}
 
 		/**
@@ -157,14 +149,12 @@ namespace QuickMath
 		 * @param other: The vector 4D.
 		 * @return The multiplied vector 4D.
 		 */
-		Vector4 operator*(const Vector4& other)
+		Vector4 operator*(const Vector4& other) const
 		{
-			return {
-				(r[0] * other[0]) + (r[1] * other[1]) + (r[2] * other[2]) + (r[3] * other[3]),
-				(g[0] * other[0]) + (g[1] * other[1]) + (g[2] * other[2]) + (g[3] * other[3]),
-				(b[0] * other[0]) + (b[1] * other[1]) + (b[2] * other[2]) + (b[3] * other[3]),
-				(a[0] * other[0]) + (a[1] * other[1]) + (a[2] * other[2]) + (a[3] * other[3])
-			};
+			__m128 columns[4] = { r.intrinsic, g.intrinsic, b.intrinsic, a.intrinsic };
+			_MM_TRANSPOSE4_PS(columns[0], columns[1], columns[2], columns[3]);
+
+			return TransformRegister<TransformKind::Homogeneous>(columns, other.intrinsic);
 		}
 
 		/**
@@ -173,15 +163,9 @@ namespace QuickMath
 		 * @param other: The other matrix to be multiplied with.
 		 * @return The multiplied matrix.
 		 */
-		Matrix44 operator*(const Matrix44& other)
+		Matrix44 operator*(const Matrix44& other) const
 		{
-			Matrix44 newMatrix = Matrix44::Identity;
-			newMatrix.r = (r * other[0][0]) + (g * other[0][1]) + (b * other[0][2]) + (a * other[0][3]);
-			newMatrix.g = (r * other[1][0]) + (g * other[1][1]) + (b * other[1][2]) + (a * other[1][3]);
-			newMatrix.b = (r * other[2][0]) + (g * other[2][1]) + (b * other[2][2]) + (a * other[2][3]);
-			newMatrix.a = (r * other[3][0]) + (g * other[3][1]) + (b * other[3][2]) + (a * other[3][3]);
-
-			return newMatrix;
+			return Matrix44(CombineRows(other.r.intrinsic), CombineRows(other.g.intrinsic), CombineRows(other.b.intrinsic), CombineRows(other.a.intrinsic));
 		}
 
 		/**
@@ -190,15 +174,10 @@ namespace QuickMath
 		 * @param value: The value to be multiplied with.
 		 * @return The divided matrix.
 		 */
-		Matrix44 operator/(const float& value)
+		Matrix44 operator/(const float& value) const
 		{
-			Matrix44 newMatrix = Matrix44::Identity;
-			newMatrix.r = r / value;
-			newMatrix.g = g / value;
-			newMatrix.b = b / value;
-			newMatrix.a = a / value;
-
-			return newMatrix;
+			const IntrinsicTraits<float, 4>::Type divisor = _mm_set1_ps(value);
+			return Matrix44(_mm_div_ps(r.intrinsic, divisor), _mm_div_ps(g.intrinsic, divisor), _mm_div_ps(b.intrinsic, divisor), _mm_div_ps(a.intrinsic, divisor));
 		}
 
 		/**
@@ -208,22 +187,79 @@ namespace QuickMath
 		 */
 		Matrix44 Transpose() const
 		{
-			return Matrix44(x.x, y.x, z.x, w.x, x.y, y.y, z.y, w.y, x.z, y.z, z.z, w.z, x.w, y.w, z.w, w.w);
+			__m128 row0 = r.intrinsic, row1 = g.intrinsic, row2 = b.intrinsic, row3 = a.intrinsic;
+			_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+			return Matrix44(row0, row1, row2, row3);
+		}
+
+		/**
+		 * Transpose the matrix straight into a buffer (16 floats, the rows of the transposed matrix), such as a GPU upload buffer.
+		 *
+		 * @param destination: The destination. It must be 16 byte aligned for non-temporal stores.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		void TransposeStore(float* destination, StoreMode mode = StoreMode::Cached) const
+		{
+			TransposeStore(this, destination, 1, mode);
+		}
+
+		/**
+		 * Transpose an array of matrices.
+		 * The output may be the same array as the input.
+		 *
+		 * @param input: The input matrices.
+		 * @param output: The transposed matrices.
+		 * @param count: The number of matrices.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		static void Transpose(const Matrix44* input, Matrix44* output, size_t count, StoreMode mode = StoreMode::Cached)
+		{
+			TransposeStore(input, &output->r.x, count, mode);
+		}
+
+		/**
+		 * Transpose an array of matrices straight into a buffer (16 floats per matrix), such as a GPU upload buffer.
+		 * The destination may be the input array itself.
+		 *
+		 * @param input: The input matrices.
+		 * @param destination: The destination. It must be 16 byte aligned for non-temporal stores.
+		 * @param count: The number of matrices.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		static void TransposeStore(const Matrix44* input, float* destination, size_t count, StoreMode mode = StoreMode::Cached)
+		{
+			if (mode == StoreMode::NonTemporal)
+			{
+				TransposeLoop<StoreMode::NonTemporal>(input, destination, count);
+				_mm_sfence();
+			}
+			else
+				TransposeLoop<StoreMode::Cached>(input, destination, count);
 		}
 
 		/**
 		 * Get the determinant of the matrix.
+		 * This uses the 2x2 block form |M| = |A||D| + |B||C| - tr((A#B)(D#C)), where A, B, C and D are the 2x2 blocks.
 		 *
 		 * @return The determinant value.
 		 */
 		float Determinant() const
 		{
-			float a = x.x * Matrix33(y.y, y.z, y.w, z.y, z.z, z.w, w.y, w.z, w.w).Determinant();
-			float b = x.y * Matrix33(y.x, y.z, y.w, z.x, z.z, z.w, w.x, w.z, w.w).Determinant();
-			float c = x.y * Matrix33(y.x, y.y, y.w, z.x, z.y, z.w, w.x, w.y, w.w).Determinant();
-			float d = x.y * Matrix33(y.x, y.y, y.z, z.x, z.y, z.z, w.x, w.y, w.z).Determinant();
+			const __m128 blockA = _mm_movelh_ps(r.intrinsic, g.intrinsic);
+			const __m128 blockB = _mm_movehl_ps(g.intrinsic, r.intrinsic);
+			const __m128 blockC = _mm_movelh_ps(b.intrinsic, a.intrinsic);
+			const __m128 blockD = _mm_movehl_ps(a.intrinsic, b.intrinsic);
+
+			const __m128 adjugateDC = AdjugateMultiply22(blockD, blockC);
+			const __m128 trace = Intrinsics::Dot4(AdjugateMultiply22(blockA, blockB), _mm_shuffle_ps(adjugateDC, adjugateDC, _MM_SHUFFLE(3, 1, 2, 0)));
 
-			return a - b + c - d;
+			// (|A|, |B|, |C|, |D|)
+			const __m128 blockDeterminants = BlockDeterminants();
+
+			// (|A||D|, |B||C|, |C||B|, |D||A|)
+			const __m128 products = _mm_mul_ps(blockDeterminants, _mm_shuffle_ps(blockDeterminants, blockDeterminants, _MM_SHUFFLE(0, 1, 2, 3)));
+			return _mm_cvtss_f32(products) + _mm_cvtss_f32(Intrinsics::Splat<1>(products)) - _mm_cvtss_f32(trace);
 		}
 
 		/**
@@ -233,38 +269,403 @@ namespace QuickMath
 		 */
 		Matrix44 Adjugate() const
 		{
-			float a = Matrix33(y.y, y.z, y.w, z.y, z.z, z.w, w.y, w.z, w.w).Determinant();
-			float b = Matrix33(y.x, y.z, y.w, z.x, z.z, z.w, w.x, w.z, w.w).Determinant();
-			float c = Matrix33(y.x, y.y, y.w, z.x, z.y, z.w, w.x, w.y, w.w).Determinant();
-			float d = Matrix33(y.x, y.y, y.z, z.x, z.y, z.z, w.x, w.y, w.z).Determinant();
+			Matrix44 adjugate(Uninitialized);
+			AdjugateBlocks(adjugate);
+			return adjugate;
+		}
 
-			float e = Matrix33(x.y, x.z, x.w, z.y, z.z, z.w, w.y, w.z, w.w).Determinant();
-			float f = Matrix33(x.x, x.z, x.w, z.x, z.z, z.w, w.x, w.z, w.w).Determinant();
-			float g = Matrix33(x.x, x.y, x.w, z.x, z.y, z.w, w.x, w.y, w.w).Determinant();
-			float h = Matrix33(x.x, x.y, x.z, z.x, z.y, z.z, w.x, w.y, w.z).Determinant();
+		/**
+		 * Get the inverse matrix of the current matrix.
+		 * The 2x2 sub-determinants are computed once and shared by the determinant and all the cofactors.
+		 * The result is not finite when the matrix is singular.
+		 *
+		 * @return The inverse matrix.
+		 */
+		Matrix44 Inverse() const
+		{
+			Matrix44 inverse(Uninitialized);
+			const __m128 determinant = AdjugateBlocks(inverse);
+
+			const __m128 inverseDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), determinant);
+			return Matrix44(
+				_mm_mul_ps(inverse.r.intrinsic, inverseDeterminant),
+				_mm_mul_ps(inverse.g.intrinsic, inverseDeterminant),
+				_mm_mul_ps(inverse.b.intrinsic, inverseDeterminant),
+				_mm_mul_ps(inverse.a.intrinsic, inverseDeterminant));
+		}
 
-			float i = Matrix33(x.y, x.z, x.w, y.y, y.z, y.w, w.y, w.z, w.w).Determinant();
-			float j = Matrix33(x.x, x.z, x.w, y.x, y.z, y.w, w.x, w.z, w.w).Determinant();
-			float k = Matrix33(x.x, x.y, x.w, y.x, y.y, y.w, w.x, w.y, w.w).Determinant();
-			float l = Matrix33(x.x, x.y, x.z, y.x, y.y, y.z, w.x, w.y, w.z).Determinant();
+		/**
+		 * Get the inverse matrix of the current matrix.
+		 * The rows are scaled to unit length (M = S * N, with S = diag(|r|, |g|, |b|, |a|)) before the determinant is formed, and
+		 * the matrix is taken as singular when |det(N)| <= tolerance (|det(N)| is at most 1), or when the inverse is not finite.
+		 * So the test and the determinant do not depend on the scale of the rows, as long as their squared lengths are normal
+		 * floats (lengths from about 1e-19 to 1e19). The result is left untouched when the matrix is singular.
+		 *
+		 * @param result: The matrix to store the inverse to.
+		 * @param tolerance: The relative tolerance. Default is DefaultInverseTolerance.
+		 * @return False if the matrix is singular.
+		 */
+		bool Inverse(Matrix44& result, float tolerance = DefaultInverseTolerance) const
+		{
+			const __m128 inverseLengths = Intrinsics::InverseRowLengths(r.intrinsic, g.intrinsic, b.intrinsic, a.intrinsic);
+			const Matrix44 normalized(
+				_mm_mul_ps(r.intrinsic, Intrinsics::Splat<0>(inverseLengths)),
+				_mm_mul_ps(g.intrinsic, Intrinsics::Splat<1>(inverseLengths)),
+				_mm_mul_ps(b.intrinsic, Intrinsics::Splat<2>(inverseLengths)),
+				_mm_mul_ps(a.intrinsic, Intrinsics::Splat<3>(inverseLengths)));
+
+			Matrix44 adjugate(Uninitialized);
+			const __m128 determinant = normalized.AdjugateBlocks(adjugate);
+			if (!Intrinsics::IsInvertible(determinant, tolerance))
+				return false;
+
+			// M^-1 = N^-1 * S^-1, which scales the columns of N^-1 by the reciprocal lengths.
+			const __m128 scale = _mm_div_ps(inverseLengths, determinant);
+			const __m128 row0 = _mm_mul_ps(adjugate.r.intrinsic, scale);
+			const __m128 row1 = _mm_mul_ps(adjugate.g.intrinsic, scale);
+			const __m128 row2 = _mm_mul_ps(adjugate.b.intrinsic, scale);
+			const __m128 row3 = _mm_mul_ps(adjugate.a.intrinsic, scale);
+			if (!Intrinsics::AllFinite(row0, row1, row2, row3))
+				return false;
+
+			result.r = row0;
+			result.g = row1;
+			result.b = row2;
+			result.a = row3;
+			return true;
+		}
 
-			float m = Matrix33(x.y, x.z, x.w, y.y, y.z, y.w, z.y, z.z, z.w).Determinant();
-			float n = Matrix33(x.x, x.z, x.w, y.x, y.z, y.w, z.x, z.z, z.w).Determinant();
-			float o = Matrix33(x.x, x.y, x.w, y.x, y.y, y.w, z.x, z.y, z.w).Determinant();
-			float p = Matrix33(x.x, x.y, x.z, y.x, y.y, y.z, z.x, z.y, z.z).Determinant();
+		/**
+		 * Transform an array of vectors (output[i] = matrix * input[i]).
+		 * The output may be the same array as the input.
+		 *
+		 * @param input: The input vectors.
+		 * @param output: The output vectors.
+		 * @param count: The number of vectors.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		void Transform(const Vector4* input, Vector4* output, size_t count, StoreMode mode = StoreMode::Cached) const
+		{
+			TransformArray<TransformKind::Homogeneous>(&input->intrinsic, &output->intrinsic, count, mode);
+		}
 
-			return Matrix44(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p);
+		/**
+		 * Transform an array of points. The w lanes of the inputs are taken as 1, so the translation is applied.
+		 * The output may be the same array as the input.
+		 *
+		 * @param input: The input points.
+		 * @param output: The output points.
+		 * @param count: The number of points.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		void TransformPoints(const Vector4* input, Vector4* output, size_t count, StoreMode mode = StoreMode::Cached) const
+		{
+			TransformArray<TransformKind::Point>(&input->intrinsic, &output->intrinsic, count, mode);
 		}
 
 		/**
-		 * Get the inverse matrix of the current matrix.
+		 * Transform an array of points. The w lanes of the inputs are taken as 1, so the translation is applied.
+		 * The w lanes of the outputs hold the transformed w, without a perspective divide.
+		 * The output may be the same array as the input.
 		 *
-		 * @return The inverse matrix.
+		 * @param input: The input points.
+		 * @param output: The output points.
+		 * @param count: The number of points.
+		 * @param mode: The store mode. Default is Cached.
 		 */
-		Matrix44 Inverse() const
+		void TransformPoints(const Vector3* input, Vector3* output, size_t count, StoreMode mode = StoreMode::Cached) const
+		{
+			TransformArray<TransformKind::Point>(&input->intrinsic, &output->intrinsic, count, mode);
+		}
+
+		/**
+		 * Transform an array of direction vectors. The w lanes of the inputs are taken as 0, so the translation is not applied.
+		 * The output may be the same array as the input.
+		 *
+		 * @param input: The input vectors.
+		 * @param output: The output vectors.
+		 * @param count: The number of vectors.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		void TransformVectors(const Vector4* input, Vector4* output, size_t count, StoreMode mode = StoreMode::Cached) const
+		{
+			TransformArray<TransformKind::Direction>(&input->intrinsic, &output->intrinsic, count, mode);
+		}
+
+		/**
+		 * Transform an array of direction vectors. The w lanes of the inputs are taken as 0, so the translation is not applied.
+		 * The output may be the same array as the input.
+		 *
+		 * @param input: The input vectors.
+		 * @param output: The output vectors.
+		 * @param count: The number of vectors.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		void TransformVectors(const Vector3* input, Vector3* output, size_t count, StoreMode mode = StoreMode::Cached) const
+		{
+			TransformArray<TransformKind::Direction>(&input->intrinsic, &output->intrinsic, count, mode);
+		}
+
+		/**
+		 * Transform an array of points and divide them by the transformed w (the w lanes of the outputs become 1).
+		 * The w lanes of the inputs are taken as 1. The output may be the same array as the input.
+		 *
+		 * @param input: The input points.
+		 * @param output: The output points.
+		 * @param count: The number of points.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		void TransformPointsProjective(const Vector4* input, Vector4* output, size_t count, StoreMode mode = StoreMode::Cached) const
 		{
-			float a = 1.0f / Determinant();
-			return Adjugate() * a;
+			TransformArray<TransformKind::Projective>(&input->intrinsic, &output->intrinsic, count, mode);
+		}
+
+		/**
+		 * Transform an array of points and divide them by the transformed w.
+		 * The w lanes of the inputs are taken as 1. The output may be the same array as the input.
+		 *
+		 * @param input: The input points.
+		 * @param output: The output points.
+		 * @param count: The number of points.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		void TransformPointsProjective(const Vector3* input, Vector3* output, size_t count, StoreMode mode = StoreMode::Cached) const
+		{
+			TransformArray<TransformKind::Projective>(&input->intrinsic, &output->intrinsic, count, mode);
+		}
+
+	private:
+		/**
+		 * Multiply two 2x2 matrices packed in registers (lhs * rhs).
+		 *
+		 * @param lhs: The LHS matrix (x.x, x.y, y.x, y.y).
+		 * @param rhs: The RHS matrix.
+		 * @return The product.
+		 */
+		static __m128 Multiply22(__m128 lhs, __m128 rhs)
+		{
+			return Intrinsics::MulAdd(lhs, _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 3, 0)),
+				_mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 2, 1, 2))));
+		}
+
+		/**
+		 * Multiply the adjugate of a 2x2 matrix by another (Adj(lhs) * rhs).
+		 *
+		 * @param lhs: The LHS matrix.
+		 * @param rhs: The RHS matrix.
+		 * @return The product.
+		 */
+		static __m128 AdjugateMultiply22(__m128 lhs, __m128 rhs)
+		{
+			return Intrinsics::MulSub(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(0, 0, 3, 3)), rhs,
+				_mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 0, 3, 2))));
+		}
+
+		/**
+		 * Multiply a 2x2 matrix by the adjugate of another (lhs * Adj(rhs)).
+		 *
+		 * @param lhs: The LHS matrix.
+		 * @param rhs: The RHS matrix.
+		 * @return The product.
+		 */
+		static __m128 MultiplyAdjugate22(__m128 lhs, __m128 rhs)
+		{
+			return Intrinsics::MulSub(lhs, _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(0, 3, 0, 3)),
+				_mm_mul_ps(_mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 2, 1, 2))));
+		}
+
+		/**
+		 * Compute the determinants of the four 2x2 blocks.
+		 *
+		 * @return The determinants (|A|, |B|, |C|, |D|).
+		 */
+		__m128 BlockDeterminants() const
+		{
+			return Intrinsics::MulSub(
+				_mm_shuffle_ps(r.intrinsic, b.intrinsic, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(g.intrinsic, a.intrinsic, _MM_SHUFFLE(3, 1, 3, 1)),
+				_mm_mul_ps(_mm_shuffle_ps(r.intrinsic, b.intrinsic, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(g.intrinsic, a.intrinsic, _MM_SHUFFLE(2, 0, 2, 0))));
+		}
+
+		/**
+		 * Compute the adjugate using the 2x2 block method.
+		 * With M = | A B |, the adjugate blocks are X = |D|A - B(D#C), Y = |B|C - D(A#B)#, Z = |C|B - A(D#C)# and W = |A|D - C(A#B)
+		 *          | C D |
+		 * (adjugated and transposed into place), where # is the 2x2 adjugate.
+		 *
+		 * @param result: The matrix to store the adjugate to.
+		 * @return The determinant, splatted to all four lanes.
+		 */
+		__m128 AdjugateBlocks(Matrix44& result) const
+		{
+			// The 2x2 adjugates of the blocks flip the signs of their off diagonal elements.
+			const __m128 signs = _mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f);
+
+			const __m128 blockA = _mm_movelh_ps(r.intrinsic, g.intrinsic);
+			const __m128 blockB = _mm_movehl_ps(g.intrinsic, r.intrinsic);
+			const __m128 blockC = _mm_movelh_ps(b.intrinsic, a.intrinsic);
+			const __m128 blockD = _mm_movehl_ps(a.intrinsic, b.intrinsic);
+
+			const __m128 blockDeterminants = BlockDeterminants();
+			const __m128 determinantA = Intrinsics::Splat<0>(blockDeterminants);
+			const __m128 determinantB = Intrinsics::Splat<1>(blockDeterminants);
+			const __m128 determinantC = Intrinsics::Splat<2>(blockDeterminants);
+			const __m128 determinantD = Intrinsics::Splat<3>(blockDeterminants);
+
+			const __m128 adjugateDC = AdjugateMultiply22(blockD, blockC);
+			const __m128 adjugateAB = AdjugateMultiply22(blockA, blockB);
+
+			const __m128 blockX = Intrinsics::MulSub(determinantD, blockA, Multiply22(blockB, adjugateDC));
+			const __m128 blockW = Intrinsics::MulSub(determinantA, blockD, Multiply22(blockC, adjugateAB));
+			const __m128 blockY = _mm_mul_ps(Intrinsics::MulSub(determinantB, blockC, MultiplyAdjugate22(blockD, adjugateAB)), signs);
+			const __m128 blockZ = _mm_mul_ps(Intrinsics::MulSub(determinantC, blockB, MultiplyAdjugate22(blockA, adjugateDC)), signs);
+
+			// |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+			const __m128 trace = Intrinsics::Dot4(adjugateAB, _mm_shuffle_ps(adjugateDC, adjugateDC, _MM_SHUFFLE(3, 1, 2, 0)));
+			const __m128 determinant = _mm_sub_ps(Intrinsics::MulAdd(determinantA, determinantD, _mm_mul_ps(determinantB, determinantC)), trace);
+
+			const __m128 signedX = _mm_mul_ps(blockX, signs);
+			const __m128 signedW = _mm_mul_ps(blockW, signs);
+			result.r = _mm_shuffle_ps(signedX, blockY, _MM_SHUFFLE(1, 3, 1, 3));
+			result.g = _mm_shuffle_ps(signedX, blockY, _MM_SHUFFLE(0, 2, 0, 2));
+			result.b = _mm_shuffle_ps(blockZ, signedW, _MM_SHUFFLE(1, 3, 1, 3));
+			result.a = _mm_shuffle_ps(blockZ, signedW, _MM_SHUFFLE(0, 2, 0, 2));
+			return determinant;
+		}
+
+		/**
+		 * How the batch transforms treat the w lanes.
+		 */
+		enum class TransformKind : unsigned char
+		{
+			Homogeneous,
+			Point,
+			Direction,
+			Projective
+		};
+
+		/**
+		 * Combine the rows using the lanes of a register as the weights (r * weights.x + g * weights.y + b * weights.z + a * weights.w).
+		 *
+		 * @param weights: The weights register.
+		 * @return The combined row.
+		 */
+		__m128 CombineRows(__m128 weights) const
+		{
+			return Intrinsics::MulAdd(a.intrinsic, Intrinsics::Splat<3>(weights),
+				Intrinsics::MulAdd(b.intrinsic, Intrinsics::Splat<2>(weights),
+					Intrinsics::MulAdd(g.intrinsic, Intrinsics::Splat<1>(weights), _mm_mul_ps(r.intrinsic, Intrinsics::Splat<0>(weights)))));
+		}
+
+		/**
+		 * Transform a single register by the matrix columns.
+		 *
+		 * @tparam Kind: How to treat the w lane.
+		 * @param columns: The matrix columns.
+		 * @param vector: The vector register.
+		 * @return The transformed register.
+		 */
+		template<TransformKind Kind>
+		static __m128 TransformRegister(const __m128* columns, __m128 vector)
+		{
+			__m128 result = Kind == TransformKind::Homogeneous ? _mm_mul_ps(columns[3], Intrinsics::Splat<3>(vector))
+				: Kind == TransformKind::Direction ? _mm_setzero_ps() : columns[3];
+
+			result = Intrinsics::MulAdd(columns[2], Intrinsics::Splat<2>(vector), result);
+			result = Intrinsics::MulAdd(columns[1], Intrinsics::Splat<1>(vector), result);
+			result = Intrinsics::MulAdd(columns[0], Intrinsics::Splat<0>(vector), result);
+
+			if (Kind == TransformKind::Projective)
+				result = _mm_div_ps(result, Intrinsics::Splat<3>(result));
+
+			return result;
+		}
+
+		/**
+		 * The batch transpose loop. Each matrix is one cache line; the loop prefetches four matrices ahead.
+		 *
+		 * @tparam Mode: The store mode.
+		 * @param input: The input matrices.
+		 * @param destination: The destination.
+		 * @param count: The number of matrices.
+		 */
+		template<StoreMode Mode>
+		static void TransposeLoop(const Matrix44* input, float* destination, size_t count)
+		{
+			for (size_t index = 0; index < count; index++, destination += 16)
+			{
+				// Forming a pointer past the end of the array is undefined, so the last four matrices are not prefetched for.
+				if (index + 4 < count)
+					_mm_prefetch(reinterpret_cast<const char*>(input + index + 4), _MM_HINT_T0);
+
+				__m128 row0 = input[index].r.intrinsic, row1 = input[index].g.intrinsic, row2 = input[index].b.intrinsic, row3 = input[index].a.intrinsic;
+				_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+				Intrinsics::Store<Mode>(destination, row0);
+				Intrinsics::Store<Mode>(destination + 4, row1);
+				Intrinsics::Store<Mode>(destination + 8, row2);
+				Intrinsics::Store<Mode>(destination + 12, row3);
+			}
+		}
+
+		/**
+		 * Transform an array of registers.
+		 * The columns stay in registers for the whole loop, which is unrolled four times (one cache line per iteration) and prefetches four lines ahead.
+		 * The non-temporal stores are fenced before returning, so the results are visible to the other threads.
+		 *
+		 * @tparam Kind: How to treat the w lanes.
+		 * @param input: The input registers.
+		 * @param output: The output registers.
+		 * @param count: The number of registers.
+		 * @param mode: The store mode.
+		 */
+		template<TransformKind Kind>
+		void TransformArray(const __m128* input, __m128* output, size_t count, StoreMode mode) const
+		{
+			__m128 columns[4] = { r.intrinsic, g.intrinsic, b.intrinsic, a.intrinsic };
+			_MM_TRANSPOSE4_PS(columns[0], columns[1], columns[2], columns[3]);
+
+			if (mode == StoreMode::NonTemporal)
+			{
+				TransformLoop<Kind, StoreMode::NonTemporal>(columns, input, output, count);
+				_mm_sfence();
+			}
+			else
+				TransformLoop<Kind, StoreMode::Cached>(columns, input, output, count);
+		}
+
+		/**
+		 * The batch transform loop.
+		 *
+		 * @tparam Kind: How to treat the w lanes.
+		 * @tparam Mode: The store mode.
+		 * @param columns: The matrix columns.
+		 * @param input: The input registers.
+		 * @param output: The output registers.
+		 * @param count: The number of registers.
+		 */
+		template<TransformKind Kind, StoreMode Mode>
+		static void TransformLoop(const __m128* columns, const __m128* input, __m128* output, size_t count)
+		{
+			size_t index = 0;
+			for (; index + 4 <= count; index += 4)
+			{
+				if (index + 16 < count)
+					_mm_prefetch(reinterpret_cast<const char*>(input + index + 16), _MM_HINT_T0);
+
+				// Load all four before storing, so the output may alias the input.
+				const __m128 result0 = TransformRegister<Kind>(columns, input[index]);
+				const __m128 result1 = TransformRegister<Kind>(columns, input[index + 1]);
+				const __m128 result2 = TransformRegister<Kind>(columns, input[index + 2]);
+				const __m128 result3 = TransformRegister<Kind>(columns, input[index + 3]);
+
+				Intrinsics::Store<Mode>(reinterpret_cast<float*>(output + index), result0);
+				Intrinsics::Store<Mode>(reinterpret_cast<float*>(output + index + 1), result1);
+				Intrinsics::Store<Mode>(reinterpret_cast<float*>(output + index + 2), result2);
+				Intrinsics::Store<Mode>(reinterpret_cast<float*>(output + index + 3), result3);
+			}
+
+			for (; index < count; index++)
+				Intrinsics::Store<Mode>(reinterpret_cast<float*>(output + index), TransformRegister<Kind>(columns, input[index]));
 		}
 
 	public:
@@ -281,4 +682,8 @@ namespace QuickMath
 			};
 		};
 	};
+
+	static_assert(sizeof(Matrix44) == 64, "Invalid Matrix44 size.");
+	static_assert(alignof(Matrix44) == 16, "Invalid Matrix44 alignment.");
+	static_assert(std::is_trivially_copyable<Matrix44>::value, "Matrix44 must be trivially copyable.");
 }
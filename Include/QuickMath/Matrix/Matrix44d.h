@@ -0,0 +1,391 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Matrix44.h"
+#include "../Vector/Vector4d.h"
+
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * Double precision matrix 4x4 for QuickMath.
+	 * The rows are Vector4d, so every row operation uses an AVX register (or two SSE2 registers).
+	 */
+	class Matrix44d final : public Matrix<Matrix44d, double>
+	{
+	public:
+		Matrix44d() : r(0.0), g(0.0), b(0.0), a(0.0) {}
+
+		/**
+		 * Construct the matrix without initializing it.
+		 */
+		explicit Matrix44d(UninitializedTag tag) : r(tag), g(tag), b(tag), a(tag) {}
+
+		/**
+		 * Construct the matrix using a value.
+		 *
+		 * @param value: The value to construct the matrix with.
+		 */
+		Matrix44d(double value) :
+			r(value, 0.0, 0.0, 0.0),
+			g(0.0, value, 0.0, 0.0),
+			b(0.0, 0.0, value, 0.0),
+			a(0.0, 0.0, 0.0, value) {}
+
+		/**
+		 * Construct the matrix using 4 4D vectors.
+		 *
+		 * @param vec1: Vector one.
+		 * @param vec2: Vector two.
+		 * @param vec3: Vector three.
+		 * @param vec4: Vector four.
+		 */
+		Matrix44d(const Vector4d& vec1, const Vector4d& vec2, const Vector4d& vec3, const Vector4d& vec4) : r(vec1), g(vec2), b(vec3), a(vec4) {}
+
+		/**
+		 * Construct the matrix by widening a single precision matrix.
+		 *
+		 * @param matrix: The single precision matrix.
+		 */
+		explicit Matrix44d(const Matrix44& matrix) : r(matrix.r), g(matrix.g), b(matrix.b), a(matrix.a) {}
+
+		/**
+		 * Construct the matrix using an initializer list.
+		 *
+		 * @param list: The initialize list.
+		 */
+		Matrix44d(std::initializer_list<double> list)
+			: r(0.0), g(0.0), b(0.0), a(0.0)
+		{
+			if ((list.size() > 16) || (list.size() < 16))
+				return;
+
+			std::copy(list.begin(), list.begin() + 4, &r.x);
+			std::copy(list.begin() + 4, list.begin() + 8, &g.x);
+			std::copy(list.begin() + 8, list.begin() + 12, &b.x);
+			std::copy(list.begin() + 12, list.end(), &a.x);
+		}
+
+		/**
+		 * Retrieve a row using the index.
+		 *
+		 * @param index: The index of the row.
+		 * @return Vector 4D row.
+		 */
+		const Vector4d operator[](unsigned int index) const
+		{
+			return (&r)[index];
+		}
+
+		/**
+		 * Retrieve a row using the index.
+		 *
+		 * @param index: The index of the row.
+		 * @return Vector 4D row.
+		 */
+		Vector4d& operator[](unsigned int index)
+		{
+			return (&r)[index];
+		}
+
+		/**
+		 * Narrow the matrix to single precision (rounded to nearest).
+		 *
+		 * @return The single precision matrix.
+		 */
+		Matrix44 ToMatrix44() const
+		{
+			return Matrix44(r.ToVector4(), g.ToVector4(), b.ToVector4(), a.ToVector4());
+		}
+
+		/**
+		 * Add two matrices.
+		 *
+		 * @param other: The other matrix.
+		 * @return The new matrix.
+		 */
+		Matrix44d operator+(const Matrix44d& other) const
+		{
+			return Matrix44d(r + other.r, g + other.g, b + other.b, a + other.a);
+		}
+
+		/**
+		 * Subtract two matrices.
+		 *
+		 * @param other: The other matrix.
+		 * @return The new matrix.
+		 */
+		Matrix44d operator-(const Matrix44d& other) const
+		{
+			return Matrix44d(r - other.r, g - other.g, b - other.b, a - other.a);
+		}
+
+		/**
+		 * Multiply the matrix by a value.
+		 *
+		 * @param value: The value to be multiplied with.
+		 * @return The multiplied matrix.
+		 */
+		Matrix44d operator*(const double& value) const
+		{
+			return Matrix44d(r * value, g * value, b * value, a * value);
+		}
+
+		/**
+		 * Multiplication operator.
+		 * Matrix * Vector.
+		 *
+		 * @param other: The vector 4D.
+		 * @return The multiplied vector 4D.
+		 */
+		Vector4d operator*(const Vector4d& other) const
+		{
+			Intrinsics::DoubleRegister column0 = r.intrinsic, column1 = g.intrinsic, column2 = b.intrinsic, column3 = a.intrinsic;
+			Intrinsics::Transpose4(column0, column1, column2, column3);
+
+			return Vector4d(Intrinsics::MulAdd(column3, Intrinsics::Splat<3>(other.intrinsic),
+				Intrinsics::MulAdd(column2, Intrinsics::Splat<2>(other.intrinsic),
+					Intrinsics::MulAdd(column1, Intrinsics::Splat<1>(other.intrinsic), Intrinsics::Mul(column0, Intrinsics::Splat<0>(other.intrinsic))))));
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param other: The other matrix to be multiplied with.
+		 * @return The multiplied matrix.
+		 */
+		Matrix44d operator*(const Matrix44d& other) const
+		{
+			return Matrix44d(CombineRows(other.r.intrinsic), CombineRows(other.g.intrinsic), CombineRows(other.b.intrinsic), CombineRows(other.a.intrinsic));
+		}
+
+		/**
+		 * Divide the matrix by a value.
+		 *
+		 * @param value: The value to be divided with.
+		 * @return The divided matrix.
+		 */
+		Matrix44d operator/(const double& value) const
+		{
+			return Matrix44d(r / value, g / value, b / value, a / value);
+		}
+
+		/**
+		 * Get the transposed matrix of this.
+		 *
+		 * @return The transposed matrix.
+		 */
+		Matrix44d Transpose() const
+		{
+			Intrinsics::DoubleRegister row0 = r.intrinsic, row1 = g.intrinsic, row2 = b.intrinsic, row3 = a.intrinsic;
+			Intrinsics::Transpose4(row0, row1, row2, row3);
+
+			return Matrix44d(row0, row1, row2, row3);
+		}
+
+		/**
+		 * Get the determinant of the matrix.
+		 * This uses the same 2x2 block form as Matrix44::Determinant, on double registers.
+		 *
+		 * @return The determinant value.
+		 */
+		double Determinant() const
+		{
+			const Intrinsics::DoubleRegister blockA = Intrinsics::MoveLowHalves(r.intrinsic, g.intrinsic);
+			const Intrinsics::DoubleRegister blockB = Intrinsics::MoveHighHalves(r.intrinsic, g.intrinsic);
+			const Intrinsics::DoubleRegister blockC = Intrinsics::MoveLowHalves(b.intrinsic, a.intrinsic);
+			const Intrinsics::DoubleRegister blockD = Intrinsics::MoveHighHalves(b.intrinsic, a.intrinsic);
+
+			const Intrinsics::DoubleRegister adjugateDC = AdjugateMultiply22(blockD, blockC);
+			const Intrinsics::DoubleRegister trace = Intrinsics::Dot4(AdjugateMultiply22(blockA, blockB), Intrinsics::Permute<0, 2, 1, 3>(adjugateDC));
+
+			// (|A|, |B|, |C|, |D|)
+			const Intrinsics::DoubleRegister blockDeterminants = BlockDeterminants(blockA, blockB, blockC, blockD);
+
+			// (|A||D|, |B||C|, |C||B|, |D||A|)
+			const Intrinsics::DoubleRegister products = Intrinsics::Mul(blockDeterminants, Intrinsics::Permute<3, 2, 1, 0>(blockDeterminants));
+			return Intrinsics::FirstLane(products) + Intrinsics::FirstLane(Intrinsics::Splat<1>(products)) - Intrinsics::FirstLane(trace);
+		}
+
+		/**
+		 * Get the inverse matrix of the current matrix.
+		 * The 2x2 sub-determinants are computed once and shared by the determinant and all the cofactors, like Matrix44::Inverse.
+		 * The result is not finite when the matrix is singular.
+		 *
+		 * @return The inverse matrix.
+		 */
+		Matrix44d Inverse() const
+		{
+			Matrix44d inverse(Uninitialized);
+			const Intrinsics::DoubleRegister inverseDeterminant = Intrinsics::Div(Intrinsics::Set1Double(1.0), AdjugateBlocks(inverse));
+
+			return Matrix44d(
+				Intrinsics::Mul(inverse.r.intrinsic, inverseDeterminant),
+				Intrinsics::Mul(inverse.g.intrinsic, inverseDeterminant),
+				Intrinsics::Mul(inverse.b.intrinsic, inverseDeterminant),
+				Intrinsics::Mul(inverse.a.intrinsic, inverseDeterminant));
+		}
+
+		/**
+		 * Get the inverse matrix of the current matrix.
+		 * The rows are scaled to unit length before the determinant is formed, and the matrix is taken as singular when the
+		 * determinant of that is <= tolerance, or when the inverse is not finite, like Matrix44::Inverse. The result is left
+		 * untouched then.
+		 *
+		 * @param result: The matrix to store the inverse to.
+		 * @param tolerance: The relative tolerance. Default is DefaultInverseToleranceDouble.
+		 * @return False if the matrix is singular.
+		 */
+		bool Inverse(Matrix44d& result, double tolerance = DefaultInverseToleranceDouble) const
+		{
+			const Intrinsics::DoubleRegister inverseLengths = Intrinsics::InverseRowLengths(r.intrinsic, g.intrinsic, b.intrinsic, a.intrinsic);
+			const Matrix44d normalized(
+				Intrinsics::Mul(r.intrinsic, Intrinsics::Splat<0>(inverseLengths)),
+				Intrinsics::Mul(g.intrinsic, Intrinsics::Splat<1>(inverseLengths)),
+				Intrinsics::Mul(b.intrinsic, Intrinsics::Splat<2>(inverseLengths)),
+				Intrinsics::Mul(a.intrinsic, Intrinsics::Splat<3>(inverseLengths)));
+
+			Matrix44d adjugate(Uninitialized);
+			const Intrinsics::DoubleRegister determinant = normalized.AdjugateBlocks(adjugate);
+			if (!Intrinsics::IsInvertible(determinant, tolerance))
+				return false;
+
+			// M^-1 = N^-1 * S^-1, which scales the columns of N^-1 by the reciprocal lengths.
+			const Intrinsics::DoubleRegister scale = Intrinsics::Div(inverseLengths, determinant);
+			const Intrinsics::DoubleRegister row0 = Intrinsics::Mul(adjugate.r.intrinsic, scale);
+			const Intrinsics::DoubleRegister row1 = Intrinsics::Mul(adjugate.g.intrinsic, scale);
+			const Intrinsics::DoubleRegister row2 = Intrinsics::Mul(adjugate.b.intrinsic, scale);
+			const Intrinsics::DoubleRegister row3 = Intrinsics::Mul(adjugate.a.intrinsic, scale);
+			if (!Intrinsics::AllFinite(row0, row1, row2, row3))
+				return false;
+
+			result.r = row0;
+			result.g = row1;
+			result.b = row2;
+			result.a = row3;
+			return true;
+		}
+
+	private:
+		/**
+		 * Multiply two 2x2 matrices packed in double registers (lhs * rhs).
+		 *
+		 * @param lhs: The LHS matrix (x.x, x.y, y.x, y.y).
+		 * @param rhs: The RHS matrix.
+		 * @return The product.
+		 */
+		static Intrinsics::DoubleRegister Multiply22(Intrinsics::DoubleRegister lhs, Intrinsics::DoubleRegister rhs)
+		{
+			return Intrinsics::MulAdd(lhs, Intrinsics::Permute<0, 3, 0, 3>(rhs),
+				Intrinsics::Mul(Intrinsics::Permute<1, 0, 3, 2>(lhs), Intrinsics::Permute<2, 1, 2, 1>(rhs)));
+		}
+
+		/**
+		 * Multiply the adjugate of a 2x2 matrix by another (Adj(lhs) * rhs).
+		 *
+		 * @param lhs: The LHS matrix.
+		 * @param rhs: The RHS matrix.
+		 * @return The product.
+		 */
+		static Intrinsics::DoubleRegister AdjugateMultiply22(Intrinsics::DoubleRegister lhs, Intrinsics::DoubleRegister rhs)
+		{
+			return Intrinsics::MulSub(Intrinsics::Permute<3, 3, 0, 0>(lhs), rhs,
+				Intrinsics::Mul(Intrinsics::Permute<1, 1, 2, 2>(lhs), Intrinsics::Permute<2, 3, 0, 1>(rhs)));
+		}
+
+		/**
+		 * Multiply a 2x2 matrix by the adjugate of another (lhs * Adj(rhs)).
+		 *
+		 * @param lhs: The LHS matrix.
+		 * @param rhs: The RHS matrix.
+		 * @return The product.
+		 */
+		static Intrinsics::DoubleRegister MultiplyAdjugate22(Intrinsics::DoubleRegister lhs, Intrinsics::DoubleRegister rhs)
+		{
+			return Intrinsics::MulSub(lhs, Intrinsics::Permute<3, 0, 3, 0>(rhs),
+				Intrinsics::Mul(Intrinsics::Permute<1, 0, 3, 2>(lhs), Intrinsics::Permute<2, 1, 2, 1>(rhs)));
+		}
+
+		/**
+		 * Compute the determinants of the four 2x2 blocks.
+		 * Transposing the blocks puts the same element of every block in one register.
+		 *
+		 * @param blockA: The upper left block.
+		 * @param blockB: The upper right block.
+		 * @param blockC: The lower left block.
+		 * @param blockD: The lower right block.
+		 * @return The determinants (|A|, |B|, |C|, |D|).
+		 */
+		static Intrinsics::DoubleRegister BlockDeterminants(Intrinsics::DoubleRegister blockA, Intrinsics::DoubleRegister blockB,
+			Intrinsics::DoubleRegister blockC, Intrinsics::DoubleRegister blockD)
+		{
+			Intrinsics::Transpose4(blockA, blockB, blockC, blockD);
+			return Intrinsics::MulSub(blockA, blockD, Intrinsics::Mul(blockB, blockC));
+		}
+
+		/**
+		 * Compute the adjugate using the 2x2 block method of Matrix44::AdjugateBlocks.
+		 *
+		 * @param result: The matrix to store the adjugate to.
+		 * @return The determinant, splatted to all four lanes.
+		 */
+		Intrinsics::DoubleRegister AdjugateBlocks(Matrix44d& result) const
+		{
+			// The 2x2 adjugates of the blocks flip the signs of their off diagonal elements.
+			const Intrinsics::DoubleRegister signs = Intrinsics::SetDouble(1.0, -1.0, -1.0, 1.0);
+
+			const Intrinsics::DoubleRegister blockA = Intrinsics::MoveLowHalves(r.intrinsic, g.intrinsic);
+			const Intrinsics::DoubleRegister blockB = Intrinsics::MoveHighHalves(r.intrinsic, g.intrinsic);
+			const Intrinsics::DoubleRegister blockC = Intrinsics::MoveLowHalves(b.intrinsic, a.intrinsic);
+			const Intrinsics::DoubleRegister blockD = Intrinsics::MoveHighHalves(b.intrinsic, a.intrinsic);
+
+			const Intrinsics::DoubleRegister blockDeterminants = BlockDeterminants(blockA, blockB, blockC, blockD);
+			const Intrinsics::DoubleRegister determinantA = Intrinsics::Splat<0>(blockDeterminants);
+			const Intrinsics::DoubleRegister determinantB = Intrinsics::Splat<1>(blockDeterminants);
+			const Intrinsics::DoubleRegister determinantC = Intrinsics::Splat<2>(blockDeterminants);
+			const Intrinsics::DoubleRegister determinantD = Intrinsics::Splat<3>(blockDeterminants);
+
+			const Intrinsics::DoubleRegister adjugateDC = AdjugateMultiply22(blockD, blockC);
+			const Intrinsics::DoubleRegister adjugateAB = AdjugateMultiply22(blockA, blockB);
+
+			const Intrinsics::DoubleRegister blockX = Intrinsics::MulSub(determinantD, blockA, Multiply22(blockB, adjugateDC));
+			const Intrinsics::DoubleRegister blockW = Intrinsics::MulSub(determinantA, blockD, Multiply22(blockC, adjugateAB));
+			const Intrinsics::DoubleRegister blockY = Intrinsics::Mul(Intrinsics::MulSub(determinantB, blockC, MultiplyAdjugate22(blockD, adjugateAB)), signs);
+			const Intrinsics::DoubleRegister blockZ = Intrinsics::Mul(Intrinsics::MulSub(determinantC, blockB, MultiplyAdjugate22(blockA, adjugateDC)), signs);
+
+			// |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+			const Intrinsics::DoubleRegister trace = Intrinsics::Dot4(adjugateAB, Intrinsics::Permute<0, 2, 1, 3>(adjugateDC));
+			const Intrinsics::DoubleRegister determinant = Intrinsics::Sub(Intrinsics::MulAdd(determinantA, determinantD, Intrinsics::Mul(determinantB, determinantC)), trace);
+
+			const Intrinsics::DoubleRegister signedX = Intrinsics::Mul(blockX, signs);
+			const Intrinsics::DoubleRegister signedW = Intrinsics::Mul(blockW, signs);
+			result.r = Intrinsics::SelectHalves(Intrinsics::Permute<3, 1, 3, 1>(signedX), Intrinsics::Permute<3, 1, 3, 1>(blockY));
+			result.g = Intrinsics::SelectHalves(Intrinsics::Permute<2, 0, 2, 0>(signedX), Intrinsics::Permute<2, 0, 2, 0>(blockY));
+			result.b = Intrinsics::SelectHalves(Intrinsics::Permute<3, 1, 3, 1>(blockZ), Intrinsics::Permute<3, 1, 3, 1>(signedW));
+			result.a = Intrinsics::SelectHalves(Intrinsics::Permute<2, 0, 2, 0>(blockZ), Intrinsics::Permute<2, 0, 2, 0>(signedW));
+			return determinant;
+		}
+
+		/**
+		 * Combine the rows using the lanes of a register as the weights (r * weights.x + g * weights.y + b * weights.z + a * weights.w).
+		 *
+		 * @param weights: The weights register.
+		 * @return The combined row.
+		 */
+		Intrinsics::DoubleRegister CombineRows(Intrinsics::DoubleRegister weights) const
+		{
+			return Intrinsics::MulAdd(a.intrinsic, Intrinsics::Splat<3>(weights),
+				Intrinsics::MulAdd(b.intrinsic, Intrinsics::Splat<2>(weights),
+					Intrinsics::MulAdd(g.intrinsic, Intrinsics::Splat<1>(weights), Intrinsics::Mul(r.intrinsic, Intrinsics::Splat<0>(weights)))));
+		}
+
+	public:
+		Vector4d r, g, b, a;
+	};
+
+	static_assert(sizeof(Matrix44d) == 128, "Invalid Matrix44d size.");
+	static_assert(alignof(Matrix44d) == alignof(IntrinsicTraits<double, 4>::Type), "Invalid Matrix44d alignment.");
+	static_assert(std::is_trivially_copyable<Matrix44d>::value, "Matrix44d must be trivially copyable.");
+}
@@ -0,0 +1,346 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Matrix33.h"
+#include "Matrix44.h"
+
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * Affine transform for QuickMath.
+	 * This stores the top three rows of a Matrix44 (48 bytes instead of 64). The fourth row is always (0, 0, 0, 1), so the
+	 * translation lives in the w lanes of the rows, and the linear (rotation and scale) part in the x, y and z lanes.
+	 * The operators have the same meaning as the Matrix44 operators.
+	 */
+	class Transform3x4 final
+	{
+	public:
+		Transform3x4() : r(0.0f), g(0.0f), b(0.0f) {}
+
+		/**
+		 * Construct the transform without initializing it.
+		 */
+		explicit Transform3x4(UninitializedTag tag) : r(tag), g(tag), b(tag) {}
+
+		/**
+		 * Construct the transform using a value.
+		 *
+		 * @param value: The value to set to the diagonal of the linear part.
+		 */
+		Transform3x4(float value) :
+			r(value, 0.0f, 0.0f, 0.0f),
+			g(0.0f, value, 0.0f, 0.0f),
+			b(0.0f, 0.0f, value, 0.0f) {}
+
+		/**
+		 * Construct the transform using 3 4D rows.
+		 *
+		 * @param vec1: Row one.
+		 * @param vec2: Row two.
+		 * @param vec3: Row three.
+		 */
+		Transform3x4(const Vector4& vec1, const Vector4& vec2, const Vector4& vec3) : r(vec1), g(vec2), b(vec3) {}
+
+		/**
+		 * Construct the transform using a linear part and a translation.
+		 *
+		 * @param linear: The linear part.
+		 * @param translation: The translation.
+		 */
+		Transform3x4(const Matrix33& linear, const Vector3& translation) :
+			r(WithTranslation(linear.r.intrinsic, Intrinsics::Splat<0>(translation.intrinsic))),
+			g(WithTranslation(linear.g.intrinsic, Intrinsics::Splat<1>(translation.intrinsic))),
+			b(WithTranslation(linear.b.intrinsic, Intrinsics::Splat<2>(translation.intrinsic))) {}
+
+		/**
+		 * Construct the transform from a matrix. The fourth row of the matrix is dropped.
+		 *
+		 * @param matrix: The matrix.
+		 */
+		explicit Transform3x4(const Matrix44& matrix) : r(matrix.r), g(matrix.g), b(matrix.b) {}
+
+		/**
+		 * Retrieve a row using the index.
+		 *
+		 * @param index: The index of the row.
+		 * @return Vector 4D row.
+		 */
+		const Vector4& operator[](unsigned int index) const
+		{
+			return (&r)[index];
+		}
+
+		/**
+		 * Retrieve a row using the index.
+		 *
+		 * @param index: The index of the row.
+		 * @return Vector 4D row.
+		 */
+		Vector4& operator[](unsigned int index)
+		{
+			return (&r)[index];
+		}
+
+		/**
+		 * Expand the transform to a matrix, with (0, 0, 0, 1) as the fourth row.
+		 *
+		 * @return The matrix.
+		 */
+		Matrix44 ToMatrix44() const
+		{
+			return Matrix44(r, g, b, Vector4(0.0f, 0.0f, 0.0f, 1.0f));
+		}
+
+		/**
+		 * Get the linear (rotation and scale) part of the transform.
+		 *
+		 * @return The linear part.
+		 */
+		Matrix33 GetLinear() const
+		{
+			const __m128 mask = LinearMask();
+			return Matrix33(_mm_and_ps(r.intrinsic, mask), _mm_and_ps(g.intrinsic, mask), _mm_and_ps(b.intrinsic, mask));
+		}
+
+		/**
+		 * Get the translation of the transform.
+		 *
+		 * @return The translation.
+		 */
+		Vector3 GetTranslation() const
+		{
+			return Vector3(r.w, g.w, b.w);
+		}
+
+		/**
+		 * Multiplication operator.
+		 * Composes the transforms the same way as Matrix44::operator*(const Matrix44&).
+		 *
+		 * @param other: The other transform to be multiplied with.
+		 * @return The composed transform.
+		 */
+		Transform3x4 operator*(const Transform3x4& other) const
+		{
+			return Transform3x4(CombineRows(other.r.intrinsic), CombineRows(other.g.intrinsic), CombineRows(other.b.intrinsic));
+		}
+
+		/**
+		 * Multiplication operator.
+		 * Transform * Vector, as if multiplied by the expanded matrix (the w component is kept).
+		 *
+		 * @param other: The vector 4D.
+		 * @return The multiplied vector 4D.
+		 */
+		Vector4 operator*(const Vector4& other) const
+		{
+			__m128 columns[4];
+			GetColumns(columns);
+
+			const __m128 vector = other.intrinsic;
+			return Intrinsics::MulAdd(columns[2], Intrinsics::Splat<2>(vector),
+				Intrinsics::MulAdd(columns[1], Intrinsics::Splat<1>(vector),
+					Intrinsics::MulAdd(columns[0], Intrinsics::Splat<0>(vector), _mm_mul_ps(columns[3], Intrinsics::Splat<3>(vector)))));
+		}
+
+		/**
+		 * Transform a point (the translation is applied).
+		 *
+		 * @param point: The point.
+		 * @return The transformed point.
+		 */
+		Vector3 TransformPoint(const Vector3& point) const
+		{
+			__m128 columns[4];
+			GetColumns(columns);
+
+			const __m128 vector = point.intrinsic;
+			return Intrinsics::MulAdd(columns[2], Intrinsics::Splat<2>(vector),
+				Intrinsics::MulAdd(columns[1], Intrinsics::Splat<1>(vector),
+					Intrinsics::MulAdd(columns[0], Intrinsics::Splat<0>(vector), columns[3])));
+		}
+
+		/**
+		 * Transform a direction vector (the translation is not applied).
+		 *
+		 * @param vector: The vector.
+		 * @return The transformed vector.
+		 */
+		Vector3 TransformVector(const Vector3& vector) const
+		{
+			__m128 columns[4];
+			GetColumns(columns);
+
+			return Intrinsics::MulAdd(columns[2], Intrinsics::Splat<2>(vector.intrinsic),
+				Intrinsics::MulAdd(columns[1], Intrinsics::Splat<1>(vector.intrinsic), _mm_mul_ps(columns[0], Intrinsics::Splat<0>(vector.intrinsic))));
+		}
+
+		/**
+		 * Get the inverse of an affine transform.
+		 * Only the linear part is inverted (with cross products, like Matrix33::Inverse), and the translation is moved through it.
+		 * The result is not finite when the linear part is singular.
+		 *
+		 * @return The inverse transform.
+		 */
+		Transform3x4 InverseAffine() const
+		{
+			Transform3x4 inverse(Uninitialized);
+			InverseAffineUnchecked(inverse);
+			return inverse;
+		}
+
+		/**
+		 * Get the inverse of an affine transform.
+		 * The rows of the linear part are scaled to unit length before the determinant is formed, and the linear part is taken as
+		 * singular when the determinant of that is <= tolerance, or when the inverse is not finite, like Matrix33::Inverse. The
+		 * result is left untouched then.
+		 * The test looks at how close the axes are to being linearly dependent, not at their lengths: a scale such as
+		 * diag(1, 1e-9, 1) is well conditioned and is inverted. Check the axis lengths separately to reject degenerate scales.
+		 *
+		 * @param result: The transform to store the inverse to.
+		 * @param tolerance: The relative tolerance. Default is DefaultInverseTolerance.
+		 * @return False if the linear part is singular.
+		 */
+		bool InverseAffine(Transform3x4& result, float tolerance = DefaultInverseTolerance) const
+		{
+			const __m128 inverseLengths = Intrinsics::InverseRowLengths(_mm_and_ps(r.intrinsic, LinearMask()), _mm_and_ps(g.intrinsic, LinearMask()),
+				_mm_and_ps(b.intrinsic, LinearMask()), _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+
+			// Scaling the whole rows (translation too) leaves the inverse translation unchanged, so only the linear part is rescaled below.
+			const Transform3x4 normalized(
+				_mm_mul_ps(r.intrinsic, Intrinsics::Splat<0>(inverseLengths)),
+				_mm_mul_ps(g.intrinsic, Intrinsics::Splat<1>(inverseLengths)),
+				_mm_mul_ps(b.intrinsic, Intrinsics::Splat<2>(inverseLengths)));
+
+			Transform3x4 inverse(Uninitialized);
+			if (!Intrinsics::IsInvertible(normalized.InverseAffineUnchecked(inverse), tolerance))
+				return false;
+
+			// The w lane of inverseLengths is 1, so the translation is kept.
+			const __m128 row0 = _mm_mul_ps(inverse.r.intrinsic, inverseLengths);
+			const __m128 row1 = _mm_mul_ps(inverse.g.intrinsic, inverseLengths);
+			const __m128 row2 = _mm_mul_ps(inverse.b.intrinsic, inverseLengths);
+			if (!Intrinsics::AllFinite(row0, row1, row2, _mm_setzero_ps()))
+				return false;
+
+			result.r = row0;
+			result.g = row1;
+			result.b = row2;
+			return true;
+		}
+
+		/**
+		 * Get the inverse of a rigid transform (the linear part is a rotation, without scale).
+		 * The linear part is transposed and the translation is rotated back, so no division is needed.
+		 *
+		 * @return The inverse transform.
+		 */
+		Transform3x4 InverseOrthonormal() const
+		{
+			// -(R^T * t) = -(r * t.x + g * t.y + b * t.z); the w lane is thrown away by the transpose.
+			__m128 translation = _mm_sub_ps(_mm_setzero_ps(), CombineRows(_mm_setr_ps(r.w, g.w, b.w, 0.0f)));
+			__m128 row0 = r.intrinsic, row1 = g.intrinsic, row2 = b.intrinsic;
+			_MM_TRANSPOSE4_PS(row0, row1, row2, translation);
+
+			return Transform3x4(row0, row1, row2);
+		}
+
+	private:
+		/**
+		 * Get the mask which keeps the x, y and z lanes.
+		 *
+		 * @return The mask.
+		 */
+		static __m128 LinearMask()
+		{
+			return _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		}
+
+		/**
+		 * Replace the w lane of a row with a translation component.
+		 *
+		 * @param row: The row.
+		 * @param translation: The splatted translation component.
+		 * @return The row.
+		 */
+		static __m128 WithTranslation(__m128 row, __m128 translation)
+		{
+			const __m128 mask = LinearMask();
+			return _mm_or_ps(_mm_and_ps(row, mask), _mm_andnot_ps(mask, translation));
+		}
+
+		/**
+		 * Get the columns of the expanded matrix. The w lanes of the columns hold the fourth row, (0, 0, 0, 1).
+		 *
+		 * @param columns: The columns to fill.
+		 */
+		void GetColumns(__m128* columns) const
+		{
+			columns[0] = r.intrinsic;
+			columns[1] = g.intrinsic;
+			columns[2] = b.intrinsic;
+			columns[3] = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+			_MM_TRANSPOSE4_PS(columns[0], columns[1], columns[2], columns[3]);
+		}
+
+		/**
+		 * Combine the rows of the expanded matrix using the lanes of a register as the weights.
+		 * The fourth row only has a 1 in the w lane, so it adds weights.w to the w lane.
+		 *
+		 * @param weights: The weights register.
+		 * @return The combined row.
+		 */
+		__m128 CombineRows(__m128 weights) const
+		{
+			return Intrinsics::MulAdd(b.intrinsic, Intrinsics::Splat<2>(weights),
+				Intrinsics::MulAdd(g.intrinsic, Intrinsics::Splat<1>(weights),
+					Intrinsics::MulAdd(r.intrinsic, Intrinsics::Splat<0>(weights), _mm_andnot_ps(LinearMask(), weights))));
+		}
+
+		/**
+		 * Compute the affine inverse without checking the determinant.
+		 *
+		 * @param result: The transform to store the inverse to.
+		 * @return The determinant of the linear part, splatted to all four lanes.
+		 */
+		__m128 InverseAffineUnchecked(Transform3x4& result) const
+		{
+			// The columns of the adjugate are the cross products of the row pairs (the w lanes come out as 0).
+			__m128 column0 = Intrinsics::Cross3(g.intrinsic, b.intrinsic);
+			__m128 column1 = Intrinsics::Cross3(b.intrinsic, r.intrinsic);
+			__m128 column2 = Intrinsics::Cross3(r.intrinsic, g.intrinsic);
+
+			const __m128 determinant = Intrinsics::Dot3(r.intrinsic, column0);
+			const __m128 inverseDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), determinant);
+
+			// -(L^-1 * t), with L^-1 = Adj(L) / |L|.
+			__m128 translation = Intrinsics::MulAdd(column2, Intrinsics::Splat<3>(b.intrinsic),
+				Intrinsics::MulAdd(column1, Intrinsics::Splat<3>(g.intrinsic), _mm_mul_ps(column0, Intrinsics::Splat<3>(r.intrinsic))));
+			translation = _mm_mul_ps(translation, _mm_sub_ps(_mm_setzero_ps(), inverseDeterminant));
+
+			column0 = _mm_mul_ps(column0, inverseDeterminant);
+			column1 = _mm_mul_ps(column1, inverseDeterminant);
+			column2 = _mm_mul_ps(column2, inverseDeterminant);
+			_MM_TRANSPOSE4_PS(column0, column1, column2, translation);
+
+			result.r = column0;
+			result.g = column1;
+			result.b = column2;
+			return determinant;
+		}
+
+	public:
+		Vector4 r, g, b;
+	};
+
+	/**
+	 * Matrix 3x4 for QuickMath.
+	 */
+	typedef Transform3x4 Matrix34;
+
+	static_assert(sizeof(Transform3x4) == 48, "Invalid Transform3x4 size.");
+	static_assert(alignof(Transform3x4) == 16, "Invalid Transform3x4 alignment.");
+	static_assert(std::is_trivially_copyable<Transform3x4>::value, "Transform3x4 must be trivially copyable.");
+}
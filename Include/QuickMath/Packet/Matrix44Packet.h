@@ -0,0 +1,218 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Vector3Packet.h"
+#include "Vector4Packet.h"
+#include "../Matrix/Matrix44.h"
+
+namespace QuickMath
+{
+	/**
+	 * Matrix 4x4 packet for QuickMath (array of structures of arrays).
+	 * This holds PacketType::Lanes Matrix44s transposed across the lanes. Each row is a Vector4Packet, so r.x holds element [0][0]
+	 * of all the matrices, and so on. The operators work on all the matrices at once, with the same meaning as the Matrix44 operators.
+	 *
+	 * @tparam PacketType: The packet type (Packet4 or Packet8).
+	 */
+	template<class PacketType>
+	class Matrix44Packet final
+	{
+	public:
+		/**
+		 * The number of matrices in the packet.
+		 */
+		static constexpr int Lanes = PacketType::Lanes;
+
+		Matrix44Packet() = default;
+
+		/**
+		 * Construct the packet using 4 row packets.
+		 *
+		 * @param vec1: Row one.
+		 * @param vec2: Row two.
+		 * @param vec3: Row three.
+		 * @param vec4: Row four.
+		 */
+		Matrix44Packet(const Vector4Packet<PacketType>& vec1, const Vector4Packet<PacketType>& vec2, const Vector4Packet<PacketType>& vec3, const Vector4Packet<PacketType>& vec4)
+			: r(vec1), g(vec2), b(vec3), a(vec4) {}
+
+		/**
+		 * Broadcast a matrix to all the lanes.
+		 *
+		 * @param matrix: The matrix.
+		 */
+		explicit Matrix44Packet(const Matrix44& matrix)
+			: r(matrix[0]), g(matrix[1]), b(matrix[2]), a(matrix[3]) {}
+
+		/**
+		 * Load PacketType::Lanes matrices from an array, transposing four rows at a time with _MM_TRANSPOSE4_PS.
+		 *
+		 * @param matrices: The first matrix.
+		 * @return The packet.
+		 */
+		static Matrix44Packet Load(const Matrix44* matrices)
+		{
+			const Vector4* rows = &matrices->r;
+			return Matrix44Packet(
+				Vector4Packet<PacketType>::Load(rows, 4),
+				Vector4Packet<PacketType>::Load(rows + 1, 4),
+				Vector4Packet<PacketType>::Load(rows + 2, 4),
+				Vector4Packet<PacketType>::Load(rows + 3, 4));
+		}
+
+		/**
+		 * Store the matrices to an array, transposing four rows at a time with _MM_TRANSPOSE4_PS.
+		 *
+		 * @param matrices: The first matrix to store to.
+		 */
+		void Store(Matrix44* matrices) const
+		{
+			Vector4* rows = &matrices->r;
+			r.Store(rows, 4);
+			g.Store(rows + 1, 4);
+			b.Store(rows + 2, 4);
+			a.Store(rows + 3, 4);
+		}
+
+		/**
+		 * Get one of the matrices.
+		 *
+		 * @param lane: The lane of the matrix.
+		 * @return The matrix.
+		 */
+		Matrix44 Get(unsigned int lane) const
+		{
+			return Matrix44(r.Get(lane), g.Get(lane), b.Get(lane), a.Get(lane));
+		}
+
+		/**
+		 * Retrieve a row using the index.
+		 *
+		 * @param index: The index of the row.
+		 * @return The row packet.
+		 */
+		const Vector4Packet<PacketType>& operator[](unsigned int index) const
+		{
+			return (&r)[index];
+		}
+
+		/**
+		 * Retrieve a row using the index.
+		 *
+		 * @param index: The index of the row.
+		 * @return The row packet.
+		 */
+		Vector4Packet<PacketType>& operator[](unsigned int index)
+		{
+			return (&r)[index];
+		}
+
+		/**
+		 * Add two matrix packets.
+		 *
+		 * @param other: The other packet.
+		 * @return The new packet.
+		 */
+		Matrix44Packet operator+(const Matrix44Packet& other) const
+		{
+			return Matrix44Packet(r + other.r, g + other.g, b + other.b, a + other.a);
+		}
+
+		/**
+		 * Subtract two matrix packets.
+		 *
+		 * @param other: The other packet.
+		 * @return The new packet.
+		 */
+		Matrix44Packet operator-(const Matrix44Packet& other) const
+		{
+			return Matrix44Packet(r - other.r, g - other.g, b - other.b, a - other.a);
+		}
+
+		/**
+		 * Multiply the matrices by a value.
+		 *
+		 * @param value: The value to be multiplied with.
+		 * @return The multiplied packet.
+		 */
+		Matrix44Packet operator*(const float& value) const
+		{
+			return Matrix44Packet(r * value, g * value, b * value, a * value);
+		}
+
+		/**
+		 * Multiplication operator.
+		 * Matrix * Vector, for each lane.
+		 *
+		 * @param other: The vector packet.
+		 * @return The multiplied vector packet.
+		 */
+		Vector4Packet<PacketType> operator*(const Vector4Packet<PacketType>& other) const
+		{
+			return Vector4Packet<PacketType>(r.Dot(other), g.Dot(other), b.Dot(other), a.Dot(other));
+		}
+
+		/**
+		 * Multiplication operator.
+		 * Matrix * Point, for each lane. The vectors are points (w = 1), so the translation is applied.
+		 *
+		 * @param other: The vector packet.
+		 * @return The transformed vector packet. The w component is dropped without a perspective divide.
+		 */
+		Vector3Packet<PacketType> operator*(const Vector3Packet<PacketType>& other) const
+		{
+			return Vector3Packet<PacketType>(
+				r.x.MulAdd(other.x, r.y.MulAdd(other.y, r.z.MulAdd(other.z, r.w))),
+				g.x.MulAdd(other.x, g.y.MulAdd(other.y, g.z.MulAdd(other.z, g.w))),
+				b.x.MulAdd(other.x, b.y.MulAdd(other.y, b.z.MulAdd(other.z, b.w))));
+		}
+
+		/**
+		 * Multiplication operator.
+		 * Each lane is multiplied like Matrix44::operator*(const Matrix44&).
+		 *
+		 * @param other: The other matrix packet to be multiplied with.
+		 * @return The multiplied packet.
+		 */
+		Matrix44Packet operator*(const Matrix44Packet& other) const
+		{
+			return Matrix44Packet(
+				a.MulAdd(other.r.w, b.MulAdd(other.r.z, g.MulAdd(other.r.y, r * other.r.x))),
+				a.MulAdd(other.g.w, b.MulAdd(other.g.z, g.MulAdd(other.g.y, r * other.g.x))),
+				a.MulAdd(other.b.w, b.MulAdd(other.b.z, g.MulAdd(other.b.y, r * other.b.x))),
+				a.MulAdd(other.a.w, b.MulAdd(other.a.z, g.MulAdd(other.a.y, r * other.a.x))));
+		}
+
+		/**
+		 * Get the transposed matrices.
+		 * This only renames the component packets, so no shuffles are needed.
+		 *
+		 * @return The transposed packet.
+		 */
+		Matrix44Packet Transpose() const
+		{
+			return Matrix44Packet(
+				Vector4Packet<PacketType>(r.x, g.x, b.x, a.x),
+				Vector4Packet<PacketType>(r.y, g.y, b.y, a.y),
+				Vector4Packet<PacketType>(r.z, g.z, b.z, a.z),
+				Vector4Packet<PacketType>(r.w, g.w, b.w, a.w));
+		}
+
+	public:
+		Vector4Packet<PacketType> r, g, b, a;
+	};
+
+	/**
+	 * 4 Matrix44s in Packet4s.
+	 */
+	typedef Matrix44Packet<Packet4> Matrix44x4;
+
+#if SSE_INSTR_SET > 6
+	/**
+	 * 8 Matrix44s in Packet8s.
+	 */
+	typedef Matrix44Packet<Packet8> Matrix44x8;
+
+#endif // SSE_INSTR_SET > 6
+}
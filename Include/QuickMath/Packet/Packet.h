@@ -0,0 +1,32 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Packet4.h"
+#include "Packet8.h"
+#include "Packet16.h"
+
+#include <cstddef>
+
+namespace QuickMath
+{
+	/**
+	 * The widest packet of the compile time instruction set.
+	 * This is Packet16 on AVX-512, Packet8 on AVX and AVX2, and Packet4 otherwise.
+	 */
+#if SSE_INSTR_SET > 8
+	typedef Packet16 NativePacket;
+
+#elif SSE_INSTR_SET > 6
+	typedef Packet8 NativePacket;
+
+#else
+	typedef Packet4 NativePacket;
+
+#endif // SSE_INSTR_SET > 8
+
+	/**
+	 * The alignment of the structure-of-arrays buffers, in bytes. This is enough for the widest packet of every tier.
+	 */
+	constexpr size_t PacketAlignment = 64;
+}
@@ -0,0 +1,525 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Packet8.h"
+
+#include <type_traits>
+
+#if SSE_INSTR_SET > 8
+
+namespace QuickMath
+{
+	/**
+	 * 16 lane float packet for QuickMath.
+	 * This class uses an AVX-512 register. The comparisons return VectorMask<16>, which lives in a mask register,
+	 * and the masked operations only touch the lanes where the mask is true.
+	 * It is only available when compiling for AVX-512F or later (SSE_INSTR_SET > 8).
+	 */
+	class Packet16 final : public Vector<Packet16, float>
+	{
+	public:
+		/**
+		 * The number of lanes in the packet.
+		 */
+		static constexpr int Lanes = 16;
+
+		Packet16() : intrinsic(_mm512_setzero_ps()) {}
+
+		/**
+		 * Set one value to all the lanes.
+		 *
+		 * @param value: Value to be stored.
+		 */
+		Packet16(float value) : intrinsic(_mm512_set1_ps(value)) {}
+
+		/**
+		 * Construct the packet using two 8 lane packets.
+		 *
+		 * @param low: The packet to be set to lanes 0 - 7.
+		 * @param high: The packet to be set to lanes 8 - 15.
+		 */
+		Packet16(const Packet8& low, const Packet8& high)
+			: intrinsic(_mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(low.intrinsic)), _mm256_castps_pd(high.intrinsic), 1))) {}
+
+		/**
+		 * Construct the packet using an intrinsic value.
+		 *
+		 * @param intrinsic: The intrinsic value.
+		 */
+		Packet16(const IntrinsicTraits<float, 16>::Type& intrinsic) : intrinsic(intrinsic) {}
+
+		/**
+		 * Load 16 values from memory. The pointer does not need to be aligned.
+		 *
+		 * @param ptr: The float pointer.
+		 */
+		Packet16(const float* ptr) : intrinsic(_mm512_loadu_ps(ptr)) {}
+
+		/**
+		 * Load 16 values from 64 byte aligned memory.
+		 *
+		 * @param ptr: The aligned float pointer.
+		 * @return The packet.
+		 */
+		static Packet16 LoadAligned(const float* ptr)
+		{
+			return Packet16(_mm512_load_ps(ptr));
+		}
+
+		/**
+		 * Store the 16 lanes to memory. The pointer does not need to be aligned.
+		 *
+		 * @param ptr: The float pointer to store to.
+		 */
+		void Store(float* ptr) const
+		{
+			_mm512_storeu_ps(ptr, intrinsic);
+		}
+
+		/**
+		 * Store the 16 lanes to 64 byte aligned memory.
+		 *
+		 * @param ptr: The aligned float pointer to store to.
+		 */
+		void StoreAligned(float* ptr) const
+		{
+			_mm512_store_ps(ptr, intrinsic);
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the lane to be accessed.
+		 * @return Float value at the index.
+		 */
+		float operator[](unsigned int index) const
+		{
+			return (operator const float* ())[index];
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the lane to be accessed.
+		 * @return Float value at the index.
+		 */
+		float& operator[](unsigned int index)
+		{
+			return const_cast<float&>((operator const float* ())[index]);
+		}
+
+		/**
+		 * Return the address of the first lane.
+		 *
+		 * @return The address of the first lane.
+		 */
+		operator float* ()
+		{
+			return lanes;
+		}
+
+		/**
+		 * Return the address of the first lane.
+		 *
+		 * @return The address of the first lane.
+		 */
+		operator const float* () const
+		{
+			return lanes;
+		}
+
+		/**
+		 * Return the stored intrinsic value.
+		 *
+		 * @return The const intrinsic value.
+		 */
+		operator const IntrinsicTraits<float, 16>::Type() const
+		{
+			return intrinsic;
+		}
+
+		/**
+		 * Get lanes 0 - 7 as an 8 lane packet.
+		 *
+		 * @return The packet.
+		 */
+		Packet8 Low() const
+		{
+			return Packet8(_mm512_castps512_ps256(intrinsic));
+		}
+
+		/**
+		 * Get lanes 8 - 15 as an 8 lane packet.
+		 *
+		 * @return The packet.
+		 */
+		Packet8 High() const
+		{
+			return Packet8(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(intrinsic), 1)));
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet16 operator+(const Packet16& other) const
+		{
+			return Packet16(_mm512_add_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet16 operator-(const Packet16& other) const
+		{
+			return Packet16(_mm512_sub_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet16 operator*(const Packet16& other) const
+		{
+			return Packet16(_mm512_mul_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet16 operator/(const Packet16& other) const
+		{
+			return Packet16(_mm512_div_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Packet16 operator+(const float& value) const
+		{
+			return Packet16(_mm512_add_ps(intrinsic, _mm512_set1_ps(value)));
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Packet16 operator-(const float& value) const
+		{
+			return Packet16(_mm512_sub_ps(intrinsic, _mm512_set1_ps(value)));
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Packet16 operator*(const float& value) const
+		{
+			return Packet16(_mm512_mul_ps(intrinsic, _mm512_set1_ps(value)));
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Packet16 operator/(const float& value) const
+		{
+			return Packet16(_mm512_div_ps(intrinsic, _mm512_set1_ps(value)));
+		}
+
+		/**
+		 * Negation operator.
+		 *
+		 * @return The negated packet.
+		 */
+		Packet16 operator-() const
+		{
+			return Packet16(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(intrinsic), _mm512_set1_epi32(0x80000000))));
+		}
+
+		/**
+		 * Multiply this by a packet and add another packet (this * multiplier + addend).
+		 * This is a single fused instruction.
+		 *
+		 * @param multiplier: The packet to multiply with.
+		 * @param addend: The packet to add.
+		 * @return The calculated packet.
+		 */
+		Packet16 MulAdd(const Packet16& multiplier, const Packet16& addend) const
+		{
+			return Packet16(Intrinsics::MulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a packet and subtract another packet (this * multiplier - subtrahend).
+		 * This is a single fused instruction.
+		 *
+		 * @param multiplier: The packet to multiply with.
+		 * @param subtrahend: The packet to subtract.
+		 * @return The calculated packet.
+		 */
+		Packet16 MulSub(const Packet16& multiplier, const Packet16& subtrahend) const
+		{
+			return Packet16(Intrinsics::MulSub(intrinsic, multiplier.intrinsic, subtrahend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a packet and subtract the product from another packet (addend - this * multiplier).
+		 * This is a single fused instruction.
+		 *
+		 * @param multiplier: The packet to multiply with.
+		 * @param addend: The packet to subtract the product from.
+		 * @return The calculated packet.
+		 */
+		Packet16 NegMulAdd(const Packet16& multiplier, const Packet16& addend) const
+		{
+			return Packet16(Intrinsics::NegMulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Get the lane-wise minimum of this and another packet.
+		 *
+		 * @param other: The other packet.
+		 * @return The minimum packet.
+		 */
+		Packet16 Min(const Packet16& other) const
+		{
+			return Packet16(_mm512_min_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Get the lane-wise maximum of this and another packet.
+		 *
+		 * @param other: The other packet.
+		 * @return The maximum packet.
+		 */
+		Packet16 Max(const Packet16& other) const
+		{
+			return Packet16(_mm512_max_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Get the lane-wise absolute value.
+		 *
+		 * @return The absolute packet.
+		 */
+		Packet16 Abs() const
+		{
+			return Packet16(_mm512_abs_ps(intrinsic));
+		}
+
+		/**
+		 * Get the lane-wise square root.
+		 *
+		 * @return The square root packet.
+		 */
+		Packet16 Sqrt() const
+		{
+			return Packet16(_mm512_sqrt_ps(intrinsic));
+		}
+
+		/**
+		 * Sum all the lanes.
+		 *
+		 * @return The sum.
+		 */
+		float HorizontalSum() const
+		{
+			return Intrinsics::HorizontalSum(intrinsic);
+		}
+
+		/**
+		 * Load the lanes where the mask is true from memory and set the rest to zero.
+		 * This reads only the lanes where the mask is true, so it is safe at the end of an array.
+		 *
+		 * @param ptr: The float pointer.
+		 * @param mask: The lanes to load.
+		 * @return The packet.
+		 */
+		static Packet16 LoadMasked(const float* ptr, const VectorMask<16>& mask)
+		{
+			return Packet16(_mm512_maskz_loadu_ps(mask.intrinsic, ptr));
+		}
+
+		/**
+		 * Store the lanes where the mask is true to memory.
+		 *
+		 * @param ptr: The float pointer to store to.
+		 * @param mask: The lanes to store.
+		 */
+		void StoreMasked(float* ptr, const VectorMask<16>& mask) const
+		{
+			_mm512_mask_storeu_ps(ptr, mask.intrinsic, intrinsic);
+		}
+
+		/**
+		 * Add a packet to the lanes where the mask is true. The other lanes keep the value of this.
+		 *
+		 * @param mask: The lanes to add.
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet16 MaskedAdd(const VectorMask<16>& mask, const Packet16& other) const
+		{
+			return Packet16(_mm512_mask_add_ps(intrinsic, mask.intrinsic, intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Subtract a packet from the lanes where the mask is true. The other lanes keep the value of this.
+		 *
+		 * @param mask: The lanes to subtract.
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet16 MaskedSub(const VectorMask<16>& mask, const Packet16& other) const
+		{
+			return Packet16(_mm512_mask_sub_ps(intrinsic, mask.intrinsic, intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Multiply the lanes where the mask is true by a packet. The other lanes keep the value of this.
+		 *
+		 * @param mask: The lanes to multiply.
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet16 MaskedMul(const VectorMask<16>& mask, const Packet16& other) const
+		{
+			return Packet16(_mm512_mask_mul_ps(intrinsic, mask.intrinsic, intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Divide the lanes where the mask is true by a packet. The other lanes keep the value of this.
+		 *
+		 * @param mask: The lanes to divide.
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet16 MaskedDiv(const VectorMask<16>& mask, const Packet16& other) const
+		{
+			return Packet16(_mm512_mask_div_ps(intrinsic, mask.intrinsic, intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Lane-wise equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<16> Equal(const Packet16& other) const
+		{
+			return VectorMask<16>(_mm512_cmp_ps_mask(intrinsic, other.intrinsic, _CMP_EQ_OQ));
+		}
+
+		/**
+		 * Lane-wise not equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<16> NotEqual(const Packet16& other) const
+		{
+			return VectorMask<16>(_mm512_cmp_ps_mask(intrinsic, other.intrinsic, _CMP_NEQ_UQ));
+		}
+
+		/**
+		 * Lane-wise less than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<16> Less(const Packet16& other) const
+		{
+			return VectorMask<16>(_mm512_cmp_ps_mask(intrinsic, other.intrinsic, _CMP_LT_OS));
+		}
+
+		/**
+		 * Lane-wise less than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<16> LessEqual(const Packet16& other) const
+		{
+			return VectorMask<16>(_mm512_cmp_ps_mask(intrinsic, other.intrinsic, _CMP_LE_OS));
+		}
+
+		/**
+		 * Lane-wise greater than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<16> Greater(const Packet16& other) const
+		{
+			return VectorMask<16>(_mm512_cmp_ps_mask(intrinsic, other.intrinsic, _CMP_GT_OS));
+		}
+
+		/**
+		 * Lane-wise greater than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<16> GreaterEqual(const Packet16& other) const
+		{
+			return VectorMask<16>(_mm512_cmp_ps_mask(intrinsic, other.intrinsic, _CMP_GE_OS));
+		}
+
+		/**
+		 * Is equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator==(const Packet16& other) const
+		{
+			return Equal(other).All();
+		}
+
+		/**
+		 * Is not equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator!=(const Packet16& other) const
+		{
+			return NotEqual(other).Any();
+		}
+
+	public:
+		union
+		{
+			float lanes[16];
+
+			IntrinsicTraits<float, 16>::Type intrinsic;
+		};
+	};
+
+	static_assert(sizeof(Packet16) == 64, "Invalid Packet16 size.");
+	static_assert(alignof(Packet16) == 64, "Invalid Packet16 alignment.");
+	static_assert(std::is_trivially_copyable<Packet16>::value, "Packet16 must be trivially copyable.");
+}
+
+#endif // SSE_INSTR_SET > 8
@@ -0,0 +1,450 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "../Vector/Vector4.h"
+
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * 4 lane float packet for QuickMath.
+	 * This class uses an SSE register to hold 4 scalar lanes of structure-of-arrays data. It has the same interface as Packet8 and
+	 * Packet16, so the batch code can be written once for all the packet widths.
+	 */
+	class Packet4 final : public Vector<Packet4, float>
+	{
+	public:
+		/**
+		 * The number of lanes in the packet.
+		 */
+		static constexpr int Lanes = 4;
+
+		Packet4() : intrinsic(_mm_setzero_ps()) {}
+
+		/**
+		 * Set one value to all the lanes.
+		 *
+		 * @param value: Value to be stored.
+		 */
+		Packet4(float value) : intrinsic(_mm_set1_ps(value)) {}
+
+		/**
+		 * Set values to all the lanes.
+		 *
+		 * @param value1: Value to be set to lane 0.
+		 * @param value2: Value to be set to lane 1.
+		 * @param value3: Value to be set to lane 2.
+		 * @param value4: Value to be set to lane 3.
+		 */
+		Packet4(float value1, float value2, float value3, float value4) : intrinsic(_mm_setr_ps(value1, value2, value3, value4)) {}
+
+		/**
+		 * Construct the packet using a 4D vector.
+		 *
+		 * @param vector: The vector.
+		 */
+		explicit Packet4(const Vector4& vector) : intrinsic(vector.intrinsic) {}
+
+		/**
+		 * Construct the packet using an intrinsic value.
+		 *
+		 * @param intrinsic: The intrinsic value.
+		 */
+		Packet4(const IntrinsicTraits<float, 4>::Type& intrinsic) : intrinsic(intrinsic) {}
+
+		/**
+		 * Load 4 values from memory. The pointer does not need to be aligned.
+		 *
+		 * @param ptr: The float pointer.
+		 */
+		Packet4(const float* ptr) : intrinsic(_mm_loadu_ps(ptr)) {}
+
+		/**
+		 * Load 4 values from 16 byte aligned memory.
+		 *
+		 * @param ptr: The aligned float pointer.
+		 * @return The packet.
+		 */
+		static Packet4 LoadAligned(const float* ptr)
+		{
+			return Packet4(_mm_load_ps(ptr));
+		}
+
+		/**
+		 * Store the 4 lanes to memory. The pointer does not need to be aligned.
+		 *
+		 * @param ptr: The float pointer to store to.
+		 */
+		void Store(float* ptr) const
+		{
+			_mm_storeu_ps(ptr, intrinsic);
+		}
+
+		/**
+		 * Store the 4 lanes to 16 byte aligned memory.
+		 *
+		 * @param ptr: The aligned float pointer to store to.
+		 */
+		void StoreAligned(float* ptr) const
+		{
+			_mm_store_ps(ptr, intrinsic);
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the lane to be accessed.
+		 * @return Float value at the index.
+		 */
+		float operator[](unsigned int index) const
+		{
+			return (operator const float* ())[index];
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the lane to be accessed.
+		 * @return Float value at the index.
+		 */
+		float& operator[](unsigned int index)
+		{
+			return const_cast<float&>((operator const float* ())[index]);
+		}
+
+		/**
+		 * Return the address of the first lane.
+		 *
+		 * @return The address of the first lane.
+		 */
+		operator float* ()
+		{
+			return lanes;
+		}
+
+		/**
+		 * Return the address of the first lane.
+		 *
+		 * @return The address of the first lane.
+		 */
+		operator const float* () const
+		{
+			return lanes;
+		}
+
+		/**
+		 * Return the stored intrinsic value.
+		 *
+		 * @return The const intrinsic value.
+		 */
+		operator const IntrinsicTraits<float, 4>::Type() const
+		{
+			return intrinsic;
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet4 operator+(const Packet4& other) const
+		{
+			return Packet4(_mm_add_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet4 operator-(const Packet4& other) const
+		{
+			return Packet4(_mm_sub_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet4 operator*(const Packet4& other) const
+		{
+			return Packet4(_mm_mul_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet4 operator/(const Packet4& other) const
+		{
+			return Packet4(_mm_div_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Packet4 operator+(const float& value) const
+		{
+			return Packet4(_mm_add_ps(intrinsic, _mm_set1_ps(value)));
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Packet4 operator-(const float& value) const
+		{
+			return Packet4(_mm_sub_ps(intrinsic, _mm_set1_ps(value)));
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Packet4 operator*(const float& value) const
+		{
+			return Packet4(_mm_mul_ps(intrinsic, _mm_set1_ps(value)));
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Packet4 operator/(const float& value) const
+		{
+			return Packet4(_mm_div_ps(intrinsic, _mm_set1_ps(value)));
+		}
+
+		/**
+		 * Negation operator.
+		 *
+		 * @return The negated packet.
+		 */
+		Packet4 operator-() const
+		{
+			return Packet4(_mm_xor_ps(intrinsic, _mm_set1_ps(-0.0f)));
+		}
+
+		/**
+		 * Multiply this by a packet and add another packet (this * multiplier + addend).
+		 * This is a single fused instruction when FMA3 is available.
+		 *
+		 * @param multiplier: The packet to multiply with.
+		 * @param addend: The packet to add.
+		 * @return The calculated packet.
+		 */
+		Packet4 MulAdd(const Packet4& multiplier, const Packet4& addend) const
+		{
+			return Packet4(Intrinsics::MulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a packet and subtract another packet (this * multiplier - subtrahend).
+		 * This is a single fused instruction when FMA3 is available.
+		 *
+		 * @param multiplier: The packet to multiply with.
+		 * @param subtrahend: The packet to subtract.
+		 * @return The calculated packet.
+		 */
+		Packet4 MulSub(const Packet4& multiplier, const Packet4& subtrahend) const
+		{
+			return Packet4(Intrinsics::MulSub(intrinsic, multiplier.intrinsic, subtrahend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a packet and subtract the product from another packet (addend - this * multiplier).
+		 * This is a single fused instruction when FMA3 is available.
+		 *
+		 * @param multiplier: The packet to multiply with.
+		 * @param addend: The packet to subtract the product from.
+		 * @return The calculated packet.
+		 */
+		Packet4 NegMulAdd(const Packet4& multiplier, const Packet4& addend) const
+		{
+			return Packet4(Intrinsics::NegMulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Get the lane-wise minimum of this and another packet.
+		 *
+		 * @param other: The other packet.
+		 * @return The minimum packet.
+		 */
+		Packet4 Min(const Packet4& other) const
+		{
+			return Packet4(_mm_min_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Get the lane-wise maximum of this and another packet.
+		 *
+		 * @param other: The other packet.
+		 * @return The maximum packet.
+		 */
+		Packet4 Max(const Packet4& other) const
+		{
+			return Packet4(_mm_max_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Get the lane-wise absolute value.
+		 *
+		 * @return The absolute packet.
+		 */
+		Packet4 Abs() const
+		{
+			return Packet4(_mm_andnot_ps(_mm_set1_ps(-0.0f), intrinsic));
+		}
+
+		/**
+		 * Get the lane-wise square root.
+		 *
+		 * @return The square root packet.
+		 */
+		Packet4 Sqrt() const
+		{
+			return Packet4(_mm_sqrt_ps(intrinsic));
+		}
+
+		/**
+		 * Sum all the lanes.
+		 *
+		 * @return The sum.
+		 */
+		float HorizontalSum() const
+		{
+			return _mm_cvtss_f32(Intrinsics::HorizontalSum(intrinsic));
+		}
+
+		/**
+		 * Lane-wise equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> Equal(const Packet4& other) const
+		{
+			return VectorMask<4>(_mm_cmpeq_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Lane-wise not equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> NotEqual(const Packet4& other) const
+		{
+			return VectorMask<4>(_mm_cmpneq_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Lane-wise less than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> Less(const Packet4& other) const
+		{
+			return VectorMask<4>(_mm_cmplt_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Lane-wise less than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> LessEqual(const Packet4& other) const
+		{
+			return VectorMask<4>(_mm_cmple_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Lane-wise greater than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> Greater(const Packet4& other) const
+		{
+			return VectorMask<4>(_mm_cmpgt_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Lane-wise greater than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> GreaterEqual(const Packet4& other) const
+		{
+			return VectorMask<4>(_mm_cmpge_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Is equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator==(const Packet4& other) const
+		{
+			return Equal(other).All();
+		}
+
+		/**
+		 * Is not equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator!=(const Packet4& other) const
+		{
+			return NotEqual(other).Any();
+		}
+
+	public:
+		union
+		{
+			float lanes[4];
+
+			IntrinsicTraits<float, 4>::Type intrinsic;
+		};
+	};
+
+	/**
+	 * Select lanes from two 4 lane packets using a mask.
+	 * This is branch free and uses _mm_blendv_ps on SSE4.1 and later.
+	 *
+	 * @param mask: The mask to select with.
+	 * @param ifTrue: The packet to take the lanes from where the mask is true.
+	 * @param ifFalse: The packet to take the lanes from where the mask is false.
+	 * @return The selected packet.
+	 */
+	inline Packet4 Select(const VectorMask<4>& mask, const Packet4& ifTrue, const Packet4& ifFalse)
+	{
+		return Packet4(Select(mask, Vector4(ifTrue.intrinsic), Vector4(ifFalse.intrinsic)).intrinsic);
+	}
+
+	static_assert(sizeof(Packet4) == 16, "Invalid Packet4 size.");
+	static_assert(alignof(Packet4) == 16, "Invalid Packet4 alignment.");
+	static_assert(std::is_trivially_copyable<Packet4>::value, "Packet4 must be trivially copyable.");
+}
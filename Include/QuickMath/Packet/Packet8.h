@@ -0,0 +1,477 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "../Vector/Vector4.h"
+
+#include <type_traits>
+
+#if SSE_INSTR_SET > 6
+
+namespace QuickMath
+{
+	/**
+	 * 8 lane float packet for QuickMath.
+	 * This class uses an AVX register, so it can hold two Vector4s or 8 scalar lanes of structure-of-arrays data.
+	 * It is only available when compiling for AVX or later (SSE_INSTR_SET > 6).
+	 */
+	class Packet8 final : public Vector<Packet8, float>
+	{
+	public:
+		/**
+		 * The number of lanes in the packet.
+		 */
+		static constexpr int Lanes = 8;
+
+		Packet8() : intrinsic(_mm256_setzero_ps()) {}
+
+		/**
+		 * Set one value to all the lanes.
+		 *
+		 * @param value: Value to be stored.
+		 */
+		Packet8(float value) : intrinsic(_mm256_set1_ps(value)) {}
+
+		/**
+		 * Set values to all the lanes.
+		 *
+		 * @param value1: Value to be set to lane 0.
+		 * @param value2: Value to be set to lane 1.
+		 * @param value3: Value to be set to lane 2.
+		 * @param value4: Value to be set to lane 3.
+		 * @param value5: Value to be set to lane 4.
+		 * @param value6: Value to be set to lane 5.
+		 * @param value7: Value to be set to lane 6.
+		 * @param value8: Value to be set to lane 7.
+		 */
+		Packet8(float value1, float value2, float value3, float value4, float value5, float value6, float value7, float value8)
+			: intrinsic(_mm256_setr_ps(value1, value2, value3, value4, value5, value6, value7, value8)) {}
+
+		/**
+		 * Construct the packet using two 4D vectors.
+		 *
+		 * @param low: The vector to be set to lanes 0 - 3.
+		 * @param high: The vector to be set to lanes 4 - 7.
+		 */
+		Packet8(const Vector4& low, const Vector4& high) : intrinsic(_mm256_insertf128_ps(_mm256_castps128_ps256(low.intrinsic), high.intrinsic, 1)) {}
+
+		/**
+		 * Construct the packet using an intrinsic value.
+		 *
+		 * @param intrinsic: The intrinsic value.
+		 */
+		Packet8(const IntrinsicTraits<float, 8>::Type& intrinsic) : intrinsic(intrinsic) {}
+
+		/**
+		 * Load 8 values from memory. The pointer does not need to be aligned.
+		 *
+		 * @param ptr: The float pointer.
+		 */
+		Packet8(const float* ptr) : intrinsic(_mm256_loadu_ps(ptr)) {}
+
+		/**
+		 * Load 8 values from 32 byte aligned memory.
+		 *
+		 * @param ptr: The aligned float pointer.
+		 * @return The packet.
+		 */
+		static Packet8 LoadAligned(const float* ptr)
+		{
+			return Packet8(_mm256_load_ps(ptr));
+		}
+
+		/**
+		 * Store the 8 lanes to memory. The pointer does not need to be aligned.
+		 *
+		 * @param ptr: The float pointer to store to.
+		 */
+		void Store(float* ptr) const
+		{
+			_mm256_storeu_ps(ptr, intrinsic);
+		}
+
+		/**
+		 * Store the 8 lanes to 32 byte aligned memory.
+		 *
+		 * @param ptr: The aligned float pointer to store to.
+		 */
+		void StoreAligned(float* ptr) const
+		{
+			_mm256_store_ps(ptr, intrinsic);
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the lane to be accessed.
+		 * @return Float value at the index.
+		 */
+		float operator[](unsigned int index) const
+		{
+			return (operator const float* ())[index];
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the lane to be accessed.
+		 * @return Float value at the index.
+		 */
+		float& operator[](unsigned int index)
+		{
+			return const_cast<float&>((operator const float* ())[index]);
+		}
+
+		/**
+		 * Return the address of the first lane.
+		 *
+		 * @return The address of the first lane.
+		 */
+		operator float* ()
+		{
+			return lanes;
+		}
+
+		/**
+		 * Return the address of the first lane.
+		 *
+		 * @return The address of the first lane.
+		 */
+		operator const float* () const
+		{
+			return lanes;
+		}
+
+		/**
+		 * Return the stored intrinsic value.
+		 *
+		 * @return The const intrinsic value.
+		 */
+		operator const IntrinsicTraits<float, 8>::Type() const
+		{
+			return intrinsic;
+		}
+
+		/**
+		 * Get lanes 0 - 3 as a 4D vector.
+		 *
+		 * @return The vector.
+		 */
+		Vector4 Low() const
+		{
+			return Vector4(_mm256_castps256_ps128(intrinsic));
+		}
+
+		/**
+		 * Get lanes 4 - 7 as a 4D vector.
+		 *
+		 * @return The vector.
+		 */
+		Vector4 High() const
+		{
+			return Vector4(_mm256_extractf128_ps(intrinsic, 1));
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet8 operator+(const Packet8& other) const
+		{
+			return Packet8(_mm256_add_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet8 operator-(const Packet8& other) const
+		{
+			return Packet8(_mm256_sub_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet8 operator*(const Packet8& other) const
+		{
+			return Packet8(_mm256_mul_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Packet8 operator/(const Packet8& other) const
+		{
+			return Packet8(_mm256_div_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Packet8 operator+(const float& value) const
+		{
+			return Packet8(_mm256_add_ps(intrinsic, _mm256_set1_ps(value)));
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Packet8 operator-(const float& value) const
+		{
+			return Packet8(_mm256_sub_ps(intrinsic, _mm256_set1_ps(value)));
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Packet8 operator*(const float& value) const
+		{
+			return Packet8(_mm256_mul_ps(intrinsic, _mm256_set1_ps(value)));
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Packet8 operator/(const float& value) const
+		{
+			return Packet8(_mm256_div_ps(intrinsic, _mm256_set1_ps(value)));
+		}
+
+		/**
+		 * Negation operator.
+		 *
+		 * @return The negated packet.
+		 */
+		Packet8 operator-() const
+		{
+			return Packet8(_mm256_xor_ps(intrinsic, _mm256_set1_ps(-0.0f)));
+		}
+
+		/**
+		 * Multiply this by a packet and add another packet (this * multiplier + addend).
+		 * This is a single fused instruction when FMA3 is available.
+		 *
+		 * @param multiplier: The packet to multiply with.
+		 * @param addend: The packet to add.
+		 * @return The calculated packet.
+		 */
+		Packet8 MulAdd(const Packet8& multiplier, const Packet8& addend) const
+		{
+			return Packet8(Intrinsics::MulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a packet and subtract another packet (this * multiplier - subtrahend).
+		 * This is a single fused instruction when FMA3 is available.
+		 *
+		 * @param multiplier: The packet to multiply with.
+		 * @param subtrahend: The packet to subtract.
+		 * @return The calculated packet.
+		 */
+		Packet8 MulSub(const Packet8& multiplier, const Packet8& subtrahend) const
+		{
+			return Packet8(Intrinsics::MulSub(intrinsic, multiplier.intrinsic, subtrahend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a packet and subtract the product from another packet (addend - this * multiplier).
+		 * This is a single fused instruction when FMA3 is available.
+		 *
+		 * @param multiplier: The packet to multiply with.
+		 * @param addend: The packet to subtract the product from.
+		 * @return The calculated packet.
+		 */
+		Packet8 NegMulAdd(const Packet8& multiplier, const Packet8& addend) const
+		{
+			return Packet8(Intrinsics::NegMulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Get the lane-wise minimum of this and another packet.
+		 *
+		 * @param other: The other packet.
+		 * @return The minimum packet.
+		 */
+		Packet8 Min(const Packet8& other) const
+		{
+			return Packet8(_mm256_min_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Get the lane-wise maximum of this and another packet.
+		 *
+		 * @param other: The other packet.
+		 * @return The maximum packet.
+		 */
+		Packet8 Max(const Packet8& other) const
+		{
+			return Packet8(_mm256_max_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Get the lane-wise absolute value.
+		 *
+		 * @return The absolute packet.
+		 */
+		Packet8 Abs() const
+		{
+			return Packet8(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), intrinsic));
+		}
+
+		/**
+		 * Get the lane-wise square root.
+		 *
+		 * @return The square root packet.
+		 */
+		Packet8 Sqrt() const
+		{
+			return Packet8(_mm256_sqrt_ps(intrinsic));
+		}
+
+		/**
+		 * Sum all the lanes.
+		 *
+		 * @return The sum.
+		 */
+		float HorizontalSum() const
+		{
+			return Intrinsics::HorizontalSum(intrinsic);
+		}
+
+		/**
+		 * Compute the 4D dot products of the two vector halves (lanes 0 - 3 and 4 - 7) with another packet.
+		 *
+		 * @param other: The other packet.
+		 * @return The low dot product splatted to lanes 0 - 3 and the high dot product splatted to lanes 4 - 7.
+		 */
+		Packet8 Dot4(const Packet8& other) const
+		{
+			return Packet8(_mm256_dp_ps(intrinsic, other.intrinsic, 0xFF));
+		}
+
+		/**
+		 * Lane-wise equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<8> Equal(const Packet8& other) const
+		{
+			return VectorMask<8>(_mm256_cmp_ps(intrinsic, other.intrinsic, _CMP_EQ_OQ));
+		}
+
+		/**
+		 * Lane-wise not equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<8> NotEqual(const Packet8& other) const
+		{
+			return VectorMask<8>(_mm256_cmp_ps(intrinsic, other.intrinsic, _CMP_NEQ_UQ));
+		}
+
+		/**
+		 * Lane-wise less than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<8> Less(const Packet8& other) const
+		{
+			return VectorMask<8>(_mm256_cmp_ps(intrinsic, other.intrinsic, _CMP_LT_OS));
+		}
+
+		/**
+		 * Lane-wise less than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<8> LessEqual(const Packet8& other) const
+		{
+			return VectorMask<8>(_mm256_cmp_ps(intrinsic, other.intrinsic, _CMP_LE_OS));
+		}
+
+		/**
+		 * Lane-wise greater than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<8> Greater(const Packet8& other) const
+		{
+			return VectorMask<8>(_mm256_cmp_ps(intrinsic, other.intrinsic, _CMP_GT_OS));
+		}
+
+		/**
+		 * Lane-wise greater than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<8> GreaterEqual(const Packet8& other) const
+		{
+			return VectorMask<8>(_mm256_cmp_ps(intrinsic, other.intrinsic, _CMP_GE_OS));
+		}
+
+		/**
+		 * Is equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator==(const Packet8& other) const
+		{
+			return Equal(other).All();
+		}
+
+		/**
+		 * Is not equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator!=(const Packet8& other) const
+		{
+			return NotEqual(other).Any();
+		}
+
+	public:
+		union
+		{
+			float lanes[8];
+
+			IntrinsicTraits<float, 8>::Type intrinsic;
+		};
+	};
+
+	static_assert(sizeof(Packet8) == 32, "Invalid Packet8 size.");
+	static_assert(alignof(Packet8) == 32, "Invalid Packet8 alignment.");
+	static_assert(std::is_trivially_copyable<Packet8>::value, "Packet8 must be trivially copyable.");
+}
+
+#endif // SSE_INSTR_SET > 6
@@ -0,0 +1,485 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Packet.h"
+#include "../Vector/Vector4.h"
+
+namespace QuickMath
+{
+	/**
+	 * 4D vector packet for QuickMath (array of structures of arrays).
+	 * This holds PacketType::Lanes Vector4s transposed across the lanes: x holds the x components of all the vectors, and so on.
+	 * The operators work on all the vectors at once, with the same meaning as the Vector4 operators.
+	 *
+	 * @tparam PacketType: The packet type (Packet4 or Packet8).
+	 */
+	template<class PacketType>
+	class Vector4Packet final : public Vector<Vector4Packet<PacketType>, float>
+	{
+	public:
+		/**
+		 * The number of vectors in the packet.
+		 */
+		static constexpr int Lanes = PacketType::Lanes;
+
+		Vector4Packet() = default;
+
+		/**
+		 * Broadcast a value to all the components of all the vectors.
+		 *
+		 * @param value: The value.
+		 */
+		Vector4Packet(float value) : x(value), y(value), z(value), w(value) {}
+
+		/**
+		 * Construct the packet using the component packets.
+		 *
+		 * @param x: The x components.
+		 * @param y: The y components.
+		 * @param z: The z components.
+		 * @param w: The w components.
+		 */
+		Vector4Packet(const PacketType& x, const PacketType& y, const PacketType& z, const PacketType& w) : x(x), y(y), z(z), w(w) {}
+
+		/**
+		 * Broadcast a vector to all the lanes.
+		 *
+		 * @param vector: The vector.
+		 */
+		explicit Vector4Packet(const Vector4& vector) : x(vector.x), y(vector.y), z(vector.z), w(vector.w) {}
+
+		/**
+		 * Load PacketType::Lanes vectors from an array of structures, transposing four vectors at a time with _MM_TRANSPOSE4_PS.
+		 *
+		 * @param vectors: The first vector.
+		 * @param stride: The distance between two vectors, in vectors. Use 4 to load the same row of consecutive Matrix44s.
+		 * @return The packet.
+		 */
+		static Vector4Packet Load(const Vector4* vectors, size_t stride = 1)
+		{
+			alignas(64) float xs[PacketType::Lanes], ys[PacketType::Lanes], zs[PacketType::Lanes], ws[PacketType::Lanes];
+			for (int group = 0; group < Lanes / 4; group++, vectors += 4 * stride)
+			{
+				__m128 x = vectors[0].intrinsic, y = vectors[stride].intrinsic, z = vectors[2 * stride].intrinsic, w = vectors[3 * stride].intrinsic;
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+
+				_mm_store_ps(xs + group * 4, x);
+				_mm_store_ps(ys + group * 4, y);
+				_mm_store_ps(zs + group * 4, z);
+				_mm_store_ps(ws + group * 4, w);
+			}
+
+			return Vector4Packet(PacketType::LoadAligned(xs), PacketType::LoadAligned(ys), PacketType::LoadAligned(zs), PacketType::LoadAligned(ws));
+		}
+
+		/**
+		 * Store the vectors to an array of structures, transposing four vectors at a time with _MM_TRANSPOSE4_PS.
+		 *
+		 * @param vectors: The first vector to store to.
+		 * @param stride: The distance between two vectors, in vectors.
+		 */
+		void Store(Vector4* vectors, size_t stride = 1) const
+		{
+			alignas(64) float xs[PacketType::Lanes], ys[PacketType::Lanes], zs[PacketType::Lanes], ws[PacketType::Lanes];
+			x.StoreAligned(xs);
+			y.StoreAligned(ys);
+			z.StoreAligned(zs);
+			w.StoreAligned(ws);
+
+			for (int group = 0; group < Lanes / 4; group++, vectors += 4 * stride)
+			{
+				__m128 x = _mm_load_ps(xs + group * 4);
+				__m128 y = _mm_load_ps(ys + group * 4);
+				__m128 z = _mm_load_ps(zs + group * 4);
+				__m128 w = _mm_load_ps(ws + group * 4);
+				_MM_TRANSPOSE4_PS(x, y, z, w);
+
+				vectors[0].intrinsic = x;
+				vectors[stride].intrinsic = y;
+				vectors[2 * stride].intrinsic = z;
+				vectors[3 * stride].intrinsic = w;
+			}
+		}
+
+		/**
+		 * Get one of the vectors.
+		 *
+		 * @param lane: The lane of the vector.
+		 * @return The vector.
+		 */
+		Vector4 Get(unsigned int lane) const
+		{
+			return Vector4(x[lane], y[lane], z[lane], w[lane]);
+		}
+
+		/**
+		 * Set one of the vectors.
+		 *
+		 * @param lane: The lane of the vector.
+		 * @param vector: The vector to set.
+		 */
+		void Set(unsigned int lane, const Vector4& vector)
+		{
+			x[lane] = vector.x;
+			y[lane] = vector.y;
+			z[lane] = vector.z;
+			w[lane] = vector.w;
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet operator+(const Vector4Packet& other) const
+		{
+			return Vector4Packet(x + other.x, y + other.y, z + other.z, w + other.w);
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet operator-(const Vector4Packet& other) const
+		{
+			return Vector4Packet(x - other.x, y - other.y, z - other.z, w - other.w);
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet operator*(const Vector4Packet& other) const
+		{
+			return Vector4Packet(x * other.x, y * other.y, z * other.z, w * other.w);
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet operator/(const Vector4Packet& other) const
+		{
+			return Vector4Packet(x / other.x, y / other.y, z / other.z, w / other.w);
+		}
+
+		/**
+		 * Addition operator. Each vector is combined with the value of its own lane.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet operator+(const PacketType& value) const
+		{
+			return Vector4Packet(x + value, y + value, z + value, w + value);
+		}
+
+		/**
+		 * Subtraction operator. Each vector is combined with the value of its own lane.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet operator-(const PacketType& value) const
+		{
+			return Vector4Packet(x - value, y - value, z - value, w - value);
+		}
+
+		/**
+		 * Multiplication operator. Each vector is combined with the value of its own lane.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet operator*(const PacketType& value) const
+		{
+			return Vector4Packet(x * value, y * value, z * value, w * value);
+		}
+
+		/**
+		 * Division operator. Each vector is combined with the value of its own lane.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet operator/(const PacketType& value) const
+		{
+			return Vector4Packet(x / value, y / value, z / value, w / value);
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet operator+(const float& value) const
+		{
+			return *this + PacketType(value);
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet operator-(const float& value) const
+		{
+			return *this - PacketType(value);
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet operator*(const float& value) const
+		{
+			return *this * PacketType(value);
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet operator/(const float& value) const
+		{
+			return *this / PacketType(value);
+		}
+
+		/**
+		 * Negation operator.
+		 *
+		 * @return The negated packet.
+		 */
+		Vector4Packet operator-() const
+		{
+			return Vector4Packet(-x, -y, -z, -w);
+		}
+
+		/**
+		 * Multiply this by a packet and add another packet (this * multiplier + addend).
+		 *
+		 * @param multiplier: The packet to multiply with.
+		 * @param addend: The packet to add.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet MulAdd(const Vector4Packet& multiplier, const Vector4Packet& addend) const
+		{
+			return Vector4Packet(x.MulAdd(multiplier.x, addend.x), y.MulAdd(multiplier.y, addend.y), z.MulAdd(multiplier.z, addend.z), w.MulAdd(multiplier.w, addend.w));
+		}
+
+		/**
+		 * Multiply this by the value of each lane and add another packet (this * multiplier + addend).
+		 *
+		 * @param multiplier: The per lane values to multiply with.
+		 * @param addend: The packet to add.
+		 * @return The calculated packet.
+		 */
+		Vector4Packet MulAdd(const PacketType& multiplier, const Vector4Packet& addend) const
+		{
+			return Vector4Packet(x.MulAdd(multiplier, addend.x), y.MulAdd(multiplier, addend.y), z.MulAdd(multiplier, addend.z), w.MulAdd(multiplier, addend.w));
+		}
+
+		/**
+		 * Lane-wise equal to comparison. A lane is true when all the components of its vectors are equal.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<PacketType::Lanes> Equal(const Vector4Packet& other) const
+		{
+			return x.Equal(other.x) & y.Equal(other.y) & z.Equal(other.z) & w.Equal(other.w);
+		}
+
+		/**
+		 * Lane-wise not equal to comparison. A lane is true when any of the components of its vectors are not equal, like the Vector4 operator!=.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<PacketType::Lanes> NotEqual(const Vector4Packet& other) const
+		{
+			return x.NotEqual(other.x) | y.NotEqual(other.y) | z.NotEqual(other.z) | w.NotEqual(other.w);
+		}
+
+		/**
+		 * Lane-wise less than comparison. A lane is true when any of the components is less, like the Vector4 operator<.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<PacketType::Lanes> Less(const Vector4Packet& other) const
+		{
+			return x.Less(other.x) | y.Less(other.y) | z.Less(other.z) | w.Less(other.w);
+		}
+
+		/**
+		 * Lane-wise less than or equal to comparison. A lane is true when all the components are less or equal, like the Vector4 operator<=.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<PacketType::Lanes> LessEqual(const Vector4Packet& other) const
+		{
+			return x.LessEqual(other.x) & y.LessEqual(other.y) & z.LessEqual(other.z) & w.LessEqual(other.w);
+		}
+
+		/**
+		 * Lane-wise greater than comparison. A lane is true when any of the components is greater, like the Vector4 operator>.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<PacketType::Lanes> Greater(const Vector4Packet& other) const
+		{
+			return x.Greater(other.x) | y.Greater(other.y) | z.Greater(other.z) | w.Greater(other.w);
+		}
+
+		/**
+		 * Lane-wise greater than or equal to comparison. A lane is true when all the components are greater or equal, like the Vector4 operator>=.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<PacketType::Lanes> GreaterEqual(const Vector4Packet& other) const
+		{
+			return x.GreaterEqual(other.x) & y.GreaterEqual(other.y) & z.GreaterEqual(other.z) & w.GreaterEqual(other.w);
+		}
+
+		/**
+		 * Is equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator==(const Vector4Packet& other) const
+		{
+			return Equal(other).All();
+		}
+
+		/**
+		 * Is not equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator!=(const Vector4Packet& other) const
+		{
+			return !Equal(other).All();
+		}
+
+		/**
+		 * Is less than operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator<(const Vector4Packet& other) const
+		{
+			return Less(other).Any();
+		}
+
+		/**
+		 * Is less than or equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator<=(const Vector4Packet& other) const
+		{
+			return LessEqual(other).All();
+		}
+
+		/**
+		 * Is grater than operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator>(const Vector4Packet& other) const
+		{
+			return Greater(other).Any();
+		}
+
+		/**
+		 * Is grater than or equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator>=(const Vector4Packet& other) const
+		{
+			return GreaterEqual(other).All();
+		}
+
+		/**
+		 * Compute the dot products of this and another packet.
+		 *
+		 * @param other: The other packet.
+		 * @return The dot product of each lane.
+		 */
+		PacketType Dot(const Vector4Packet& other) const
+		{
+			return x.MulAdd(other.x, y.MulAdd(other.y, z.MulAdd(other.z, w * other.w)));
+		}
+
+		/**
+		 * Get the squared lengths of the vectors.
+		 *
+		 * @return The squared length of each lane.
+		 */
+		PacketType LengthSquared() const
+		{
+			return x.MulAdd(x, y.MulAdd(y, z.MulAdd(z, w * w)));
+		}
+
+		/**
+		 * Get the lengths of the vectors.
+		 *
+		 * @return The length of each lane.
+		 */
+		PacketType Length() const
+		{
+			return LengthSquared().Sqrt();
+		}
+
+		/**
+		 * Normalize the vectors. Zero length vectors result in NaN.
+		 *
+		 * @return The normalized packet.
+		 */
+		Vector4Packet Normalize() const
+		{
+			return *this / Length();
+		}
+
+	public:
+		PacketType x, y, z, w;
+	};
+
+	/**
+	 * 4 Vector4s in a Packet4.
+	 */
+	typedef Vector4Packet<Packet4> Vector4x4;
+
+#if SSE_INSTR_SET > 6
+	/**
+	 * 8 Vector4s in a Packet8.
+	 */
+	typedef Vector4Packet<Packet8> Vector4x8;
+
+#endif // SSE_INSTR_SET > 6
+}
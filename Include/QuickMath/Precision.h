@@ -0,0 +1,114 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "IncludeSIMD.h"
+
+namespace QuickMath
+{
+	/**
+	 * Precision policies for the reciprocal square root based functions (InvLength, Normalize).
+	 * Each policy trades accuracy for throughput, and can be selected per call site.
+	 *
+	 * The error bounds are for the reciprocal square root itself and are measured against a correctly rounded result.
+	 * Normalize adds the rounding of one more multiply (0.5 ulp) to the Refined and Fast policies.
+	 */
+	namespace Precision
+	{
+		/**
+		 * Exact precision policy.
+		 * Uses _mm_sqrt_ps followed by a division. Both are correctly rounded, so the error is at most 1.5 ulp.
+		 * Normalize divides by the length directly, so it is as accurate as the scalar version.
+		 */
+		struct Exact
+		{
+			/**
+			 * Compute the reciprocal square root of all the lanes.
+			 *
+			 * @param value: The input register.
+			 * @return The reciprocal square roots.
+			 */
+			static __m128 InverseSqrt(__m128 value)
+			{
+				return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(value));
+			}
+
+			/**
+			 * Scale a vector to unit length.
+			 *
+			 * @param vector: The vector to normalize.
+			 * @param lengthSquared: The squared length of the vector, splatted.
+			 * @return The normalized vector.
+			 */
+			static __m128 Normalize(__m128 vector, __m128 lengthSquared)
+			{
+				return _mm_div_ps(vector, _mm_sqrt_ps(lengthSquared));
+			}
+		};
+
+		/**
+		 * Refined precision policy.
+		 * Uses the _mm_rsqrt_ps estimate followed by one Newton-Raphson step. The error is at most 5 ulp.
+		 * Zero and infinite inputs result in NaN.
+		 */
+		struct Refined
+		{
+			/**
+			 * Compute the reciprocal square root of all the lanes.
+			 *
+			 * @param value: The input register.
+			 * @return The reciprocal square roots.
+			 */
+			static __m128 InverseSqrt(__m128 value)
+			{
+				// y1 = y0 * (1.5 - 0.5 * x * y0 * y0)
+				const __m128 estimate = _mm_rsqrt_ps(value);
+				const __m128 halfValue = _mm_mul_ps(value, _mm_set1_ps(0.5f));
+				const __m128 correction = _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(halfValue, estimate), estimate));
+				return _mm_mul_ps(estimate, correction);
+			}
+
+			/**
+			 * Scale a vector to unit length.
+			 *
+			 * @param vector: The vector to normalize.
+			 * @param lengthSquared: The squared length of the vector, splatted.
+			 * @return The normalized vector.
+			 */
+			static __m128 Normalize(__m128 vector, __m128 lengthSquared)
+			{
+				return _mm_mul_ps(vector, InverseSqrt(lengthSquared));
+			}
+		};
+
+		/**
+		 * Fast precision policy.
+		 * Uses the raw _mm_rsqrt_ps estimate. The relative error is at most 1.5 * 2^-12, which is at most 6144 ulp (about 11 bits).
+		 */
+		struct Fast
+		{
+			/**
+			 * Compute the reciprocal square root of all the lanes.
+			 *
+			 * @param value: The input register.
+			 * @return The reciprocal square roots.
+			 */
+			static __m128 InverseSqrt(__m128 value)
+			{
+				return _mm_rsqrt_ps(value);
+			}
+
+			/**
+			 * Scale a vector to unit length.
+			 *
+			 * @param vector: The vector to normalize.
+			 * @param lengthSquared: The squared length of the vector, splatted.
+			 * @return The normalized vector.
+			 */
+			static __m128 Normalize(__m128 vector, __m128 lengthSquared)
+			{
+				return _mm_mul_ps(vector, _mm_rsqrt_ps(lengthSquared));
+			}
+		};
+	}
+}
@@ -0,0 +1,158 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Quaternion.h"
+
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * Dual quaternion for QuickMath.
+	 * This holds a rigid transform (a rotation and a translation, without scale) in two quaternions, 32 bytes in total. The real part is
+	 * the rotation, and the dual part is 0.5 * translation * rotation. Unlike matrices, dual quaternions can be blended without
+	 * shrinking the result, which is why they are used for skinning.
+	 */
+	class DualQuaternion final
+	{
+	public:
+		DualQuaternion() : dual(0.0f, 0.0f, 0.0f, 0.0f) {}
+
+		/**
+		 * Construct the dual quaternion without initializing it.
+		 */
+		explicit DualQuaternion(UninitializedTag tag) : real(tag), dual(tag) {}
+
+		/**
+		 * Construct the dual quaternion using its parts.
+		 *
+		 * @param real: The real part.
+		 * @param dual: The dual part.
+		 */
+		DualQuaternion(const Quaternion& real, const Quaternion& dual) : real(real), dual(dual) {}
+
+		/**
+		 * Construct the dual quaternion using a rotation and a translation.
+		 *
+		 * @param rotation: The unit rotation.
+		 * @param translation: The translation, applied after the rotation.
+		 */
+		DualQuaternion(const Quaternion& rotation, const Vector3& translation)
+			: real(rotation), dual(Quaternion(_mm_mul_ps(Quaternion(PureQuaternion(translation.intrinsic)) * rotation, _mm_set1_ps(0.5f)))) {}
+
+		/**
+		 * Construct the dual quaternion from a rigid transform matrix.
+		 * The rotation is taken from the upper 3x3 (which must be a pure rotation) and the translation from the w column.
+		 *
+		 * @param matrix: The matrix.
+		 */
+		explicit DualQuaternion(const Matrix44& matrix) : DualQuaternion(Quaternion(matrix), Vector3(matrix.r.w, matrix.g.w, matrix.b.w)) {}
+
+		/**
+		 * Multiplication operator (the Hamilton product, like Quaternion).
+		 * (a * b).TransformPoint(v) is a.TransformPoint(b.TransformPoint(v)), so other is applied first. This is the opposite of the
+		 * Matrix44 product, where (A * B) * v is B * (A * v) and A is applied first.
+		 *
+		 * @param other: The other dual quaternion.
+		 * @return The product, which transforms by other first and then by this.
+		 */
+		DualQuaternion operator*(const DualQuaternion& other) const
+		{
+			return DualQuaternion(real * other.real, Quaternion(_mm_add_ps(real * other.dual, dual * other.real)));
+		}
+
+		/**
+		 * Get the rotation.
+		 *
+		 * @return The rotation.
+		 */
+		Quaternion GetRotation() const
+		{
+			return real;
+		}
+
+		/**
+		 * Get the translation (2 * dual * real^-1). The real part must be normalized.
+		 *
+		 * @return The translation.
+		 */
+		Vector3 GetTranslation() const
+		{
+			const __m128 product = dual * real.Conjugate();
+			return PureQuaternion(_mm_add_ps(product, product));
+		}
+
+		/**
+		 * Normalize the dual quaternion by dividing both parts by the length of the real part.
+		 * A blend of unit dual quaternions needs this before it is used as a transform.
+		 *
+		 * @tparam Policy: The precision policy (Precision::Exact, Precision::Refined or Precision::Fast).
+		 * @return The normalized dual quaternion.
+		 */
+		template<class Policy = Precision::Exact>
+		DualQuaternion Normalize() const
+		{
+			const __m128 inverseLength = Policy::InverseSqrt(Intrinsics::Dot4(real.intrinsic, real.intrinsic));
+			return DualQuaternion(Quaternion(_mm_mul_ps(real.intrinsic, inverseLength)), Quaternion(_mm_mul_ps(dual.intrinsic, inverseLength)));
+		}
+
+		/**
+		 * Transform a point (the translation is applied). The dual quaternion must be normalized.
+		 *
+		 * @param point: The point.
+		 * @return The transformed point.
+		 */
+		Vector3 TransformPoint(const Vector3& point) const
+		{
+			return real.Rotate(point) + GetTranslation();
+		}
+
+		/**
+		 * Transform a direction vector (the translation is not applied). The dual quaternion must be normalized.
+		 *
+		 * @param vector: The vector.
+		 * @return The transformed vector.
+		 */
+		Vector3 TransformVector(const Vector3& vector) const
+		{
+			return real.Rotate(vector);
+		}
+
+		/**
+		 * Convert the dual quaternion to a matrix. The dual quaternion must be normalized.
+		 *
+		 * @return The matrix.
+		 */
+		Matrix44 ToMatrix44() const
+		{
+			const Vector3 translation = GetTranslation();
+
+			Matrix44 matrix = real.ToMatrix44();
+			matrix.r.w = translation.x;
+			matrix.g.w = translation.y;
+			matrix.b.w = translation.z;
+			return matrix;
+		}
+
+	private:
+		/**
+		 * Clear the w lane of a register, so that it holds a pure (imaginary) quaternion or a Vector3.
+		 *
+		 * @param value: The register.
+		 * @return The register with w = 0.
+		 */
+		static __m128 PureQuaternion(__m128 value)
+		{
+			return _mm_and_ps(value, _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0)));
+		}
+
+	public:
+		Quaternion real;
+		Quaternion dual;
+	};
+
+	static_assert(sizeof(DualQuaternion) == 32, "Invalid DualQuaternion size.");
+	static_assert(alignof(DualQuaternion) == 16, "Invalid DualQuaternion alignment.");
+	static_assert(std::is_trivially_copyable<DualQuaternion>::value, "DualQuaternion must be trivially copyable.");
+}
@@ -0,0 +1,370 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "../Matrix/Matrix33.h"
+#include "../Matrix/Matrix44.h"
+#include "../Precision.h"
+
+#include <cmath>
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * Quaternion for QuickMath.
+	 * The imaginary part is stored in x, y and z, and the real part in w, all in one SSE register.
+	 * Rotations follow the matrices: q.ToMatrix33() * v is the same as q.Rotate(v). The product q1 * q2 is the Hamilton product, so it
+	 * rotates by q2 first and then by q1.
+	 */
+	class Quaternion final
+	{
+	public:
+		Quaternion() : intrinsic(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f)) {}
+
+		/**
+		 * Construct the quaternion without initializing it.
+		 */
+		explicit Quaternion(UninitializedTag) {}
+
+		/**
+		 * Construct the quaternion using its components.
+		 *
+		 * @param x: The x component.
+		 * @param y: The y component.
+		 * @param z: The z component.
+		 * @param w: The w (real) component.
+		 */
+		Quaternion(float x, float y, float z, float w) : intrinsic(_mm_setr_ps(x, y, z, w)) {}
+
+		/**
+		 * Construct the quaternion using an intrinsic value.
+		 *
+		 * @param intrinsic: The intrinsic value.
+		 */
+		Quaternion(const IntrinsicTraits<float, 4>::Type& intrinsic) : intrinsic(intrinsic) {}
+
+		/**
+		 * Construct the quaternion from a rotation matrix.
+		 *
+		 * @param matrix: The rotation matrix. It must be orthonormal.
+		 */
+		explicit Quaternion(const Matrix33& matrix)
+			: Quaternion(FromRotation(
+				matrix.r.x, matrix.r.y, matrix.r.z,
+				matrix.g.x, matrix.g.y, matrix.g.z,
+				matrix.b.x, matrix.b.y, matrix.b.z)) {}
+
+		/**
+		 * Construct the quaternion from the rotation part (the upper 3x3) of a matrix.
+		 *
+		 * @param matrix: The matrix. The upper 3x3 must be orthonormal.
+		 */
+		explicit Quaternion(const Matrix44& matrix)
+			: Quaternion(FromRotation(
+				matrix.r.x, matrix.r.y, matrix.r.z,
+				matrix.g.x, matrix.g.y, matrix.g.z,
+				matrix.b.x, matrix.b.y, matrix.b.z)) {}
+
+		/**
+		 * Create a rotation around an axis.
+		 *
+		 * @param axis: The axis. It must be normalized.
+		 * @param angle: The angle in radians.
+		 * @return The quaternion.
+		 */
+		static Quaternion FromAxisAngle(const Vector3& axis, float angle)
+		{
+			const float sine = std::sin(angle * 0.5f);
+			return Quaternion(axis.x * sine, axis.y * sine, axis.z * sine, std::cos(angle * 0.5f));
+		}
+
+		/**
+		 * Cast the quaternion to its intrinsic value.
+		 *
+		 * @return The intrinsic value.
+		 */
+		operator IntrinsicTraits<float, 4>::Type() const
+		{
+			return intrinsic;
+		}
+
+		/**
+		 * Multiplication operator (the Hamilton product).
+		 *
+		 * @param other: The other quaternion.
+		 * @return The product, which rotates by other first and then by this.
+		 */
+		Quaternion operator*(const Quaternion& other) const
+		{
+			// Each lane of this scales a shuffled and sign flipped copy of other.
+			const __m128 negateYW = _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f);
+			const __m128 negateZW = _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f);
+			const __m128 negateXW = _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f);
+
+			__m128 result = _mm_mul_ps(Intrinsics::Splat<3>(intrinsic), other.intrinsic);
+			result = Intrinsics::MulAdd(Intrinsics::Splat<0>(intrinsic),
+				_mm_xor_ps(_mm_shuffle_ps(other.intrinsic, other.intrinsic, _MM_SHUFFLE(0, 1, 2, 3)), negateYW), result);
+			result = Intrinsics::MulAdd(Intrinsics::Splat<1>(intrinsic),
+				_mm_xor_ps(_mm_shuffle_ps(other.intrinsic, other.intrinsic, _MM_SHUFFLE(1, 0, 3, 2)), negateZW), result);
+			result = Intrinsics::MulAdd(Intrinsics::Splat<2>(intrinsic),
+				_mm_xor_ps(_mm_shuffle_ps(other.intrinsic, other.intrinsic, _MM_SHUFFLE(2, 3, 0, 1)), negateXW), result);
+
+			return result;
+		}
+
+		/**
+		 * Multiplication assignment operator.
+		 *
+		 * @param other: The other quaternion.
+		 * @return This quaternion.
+		 */
+		Quaternion& operator*=(const Quaternion& other)
+		{
+			*this = *this * other;
+			return *this;
+		}
+
+		/**
+		 * Get the dot product of this and another quaternion.
+		 *
+		 * @param other: The other quaternion.
+		 * @return The dot product.
+		 */
+		float Dot(const Quaternion& other) const
+		{
+			return _mm_cvtss_f32(Intrinsics::Dot4(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Get the squared length of the quaternion.
+		 *
+		 * @return The squared length.
+		 */
+		float LengthSquared() const
+		{
+			return Dot(*this);
+		}
+
+		/**
+		 * Get the length of the quaternion.
+		 *
+		 * @return The length.
+		 */
+		float Length() const
+		{
+			return _mm_cvtss_f32(_mm_sqrt_ss(Intrinsics::Dot4(intrinsic, intrinsic)));
+		}
+
+		/**
+		 * Get the unit quaternion in the direction of this quaternion.
+		 *
+		 * @tparam Policy: The precision policy (Precision::Exact, Precision::Refined or Precision::Fast).
+		 * @return The normalized quaternion.
+		 */
+		template<class Policy = Precision::Exact>
+		Quaternion Normalize() const
+		{
+			return Policy::Normalize(intrinsic, Intrinsics::Dot4(intrinsic, intrinsic));
+		}
+
+		/**
+		 * Get the conjugate of the quaternion (the imaginary part negated).
+		 * This is the inverse of a unit quaternion.
+		 *
+		 * @return The conjugate.
+		 */
+		Quaternion Conjugate() const
+		{
+			return _mm_xor_ps(intrinsic, _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f));
+		}
+
+		/**
+		 * Get the inverse of the quaternion.
+		 * Use Conjugate instead for unit quaternions.
+		 *
+		 * @return The inverse.
+		 */
+		Quaternion Inverse() const
+		{
+			return _mm_div_ps(Conjugate().intrinsic, Intrinsics::Dot4(intrinsic, intrinsic));
+		}
+
+		/**
+		 * Rotate a vector.
+		 * This computes v + w * t + q.xyz x t with t = 2 * (q.xyz x v), which is cheaper than q * v * q^-1.
+		 *
+		 * @param vector: The vector to rotate.
+		 * @return The rotated vector.
+		 */
+		Vector3 Rotate(const Vector3& vector) const
+		{
+			const __m128 cross = Intrinsics::Cross3(intrinsic, vector.intrinsic);
+			const __m128 twiceCross = _mm_add_ps(cross, cross);
+
+			return _mm_add_ps(Intrinsics::MulAdd(Intrinsics::Splat<3>(intrinsic), twiceCross, vector.intrinsic), Intrinsics::Cross3(intrinsic, twiceCross));
+		}
+
+		/**
+		 * Rotate an array of vectors.
+		 * The quaternion is converted to a matrix once, and the vectors go through Matrix44::TransformVectors.
+		 * The output may be the same array as the input.
+		 *
+		 * @param input: The input vectors.
+		 * @param output: The rotated vectors.
+		 * @param count: The number of vectors.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		void Rotate(const Vector3* input, Vector3* output, size_t count, StoreMode mode = StoreMode::Cached) const
+		{
+			ToMatrix44().TransformVectors(input, output, count, mode);
+		}
+
+		/**
+		 * Rotate an array of vectors. The w components are kept.
+		 * The quaternion is converted to a matrix once, and the vectors go through Matrix44::Transform.
+		 * The output may be the same array as the input.
+		 *
+		 * @param input: The input vectors.
+		 * @param output: The rotated vectors.
+		 * @param count: The number of vectors.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		void Rotate(const Vector4* input, Vector4* output, size_t count, StoreMode mode = StoreMode::Cached) const
+		{
+			ToMatrix44().Transform(input, output, count, mode);
+		}
+
+		/**
+		 * Normalized linear interpolation along the shortest path.
+		 * This is cheaper than Slerp, but the angular speed is not constant.
+		 *
+		 * @param other: The quaternion to interpolate to.
+		 * @param factor: The interpolation factor, from 0 (this) to 1 (other).
+		 * @return The interpolated unit quaternion.
+		 */
+		Quaternion Nlerp(const Quaternion& other, float factor) const
+		{
+			// Flip other to the same hemisphere by moving the sign of the dot product into it.
+			const __m128 sign = _mm_and_ps(Intrinsics::Dot4(intrinsic, other.intrinsic), _mm_set1_ps(-0.0f));
+			const __m128 target = _mm_xor_ps(other.intrinsic, sign);
+
+			return Quaternion(Intrinsics::MulAdd(_mm_sub_ps(target, intrinsic), _mm_set1_ps(factor), intrinsic)).Normalize();
+		}
+
+		/**
+		 * Spherical linear interpolation along the shortest path.
+		 * Nearly parallel quaternions fall back to Nlerp, where the sine of the angle is too small to divide by.
+		 *
+		 * @param other: The quaternion to interpolate to.
+		 * @param factor: The interpolation factor, from 0 (this) to 1 (other).
+		 * @return The interpolated unit quaternion.
+		 */
+		Quaternion Slerp(const Quaternion& other, float factor) const
+		{
+			float cosine = Dot(other);
+			__m128 target = other.intrinsic;
+			if (cosine < 0.0f)
+			{
+				cosine = -cosine;
+				target = _mm_xor_ps(target, _mm_set1_ps(-0.0f));
+			}
+
+			if (cosine > 0.9995f)
+				return Nlerp(target, factor);
+
+			const float angle = std::acos(cosine);
+			const float inverseSine = 1.0f / std::sin(angle);
+
+			return Intrinsics::MulAdd(target, _mm_set1_ps(std::sin(factor * angle) * inverseSine),
+				_mm_mul_ps(intrinsic, _mm_set1_ps(std::sin((1.0f - factor) * angle) * inverseSine)));
+		}
+
+		/**
+		 * Convert the quaternion to a rotation matrix.
+		 * The quaternion must be normalized.
+		 *
+		 * @return The rotation matrix.
+		 */
+		Matrix33 ToMatrix33() const
+		{
+			const float xx = x * x, yy = y * y, zz = z * z;
+			const float xy = x * y, xz = x * z, yz = y * z;
+			const float wx = w * x, wy = w * y, wz = w * z;
+
+			return Matrix33(
+				1.0f - 2.0f * (yy + zz), 2.0f * (xy - wz), 2.0f * (xz + wy),
+				2.0f * (xy + wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz - wx),
+				2.0f * (xz - wy), 2.0f * (yz + wx), 1.0f - 2.0f * (xx + yy));
+		}
+
+		/**
+		 * Convert the quaternion to a rotation matrix, with no translation.
+		 * The quaternion must be normalized.
+		 *
+		 * @return The rotation matrix.
+		 */
+		Matrix44 ToMatrix44() const
+		{
+			const float xx = x * x, yy = y * y, zz = z * z;
+			const float xy = x * y, xz = x * z, yz = y * z;
+			const float wx = w * x, wy = w * y, wz = w * z;
+
+			return Matrix44(
+				Vector4(1.0f - 2.0f * (yy + zz), 2.0f * (xy - wz), 2.0f * (xz + wy), 0.0f),
+				Vector4(2.0f * (xy + wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz - wx), 0.0f),
+				Vector4(2.0f * (xz - wy), 2.0f * (yz + wx), 1.0f - 2.0f * (xx + yy), 0.0f),
+				Vector4(0.0f, 0.0f, 0.0f, 1.0f));
+		}
+
+	private:
+		/**
+		 * Extract the quaternion from the elements of a rotation matrix (Shepperd's method).
+		 * The largest of the four diagonal combinations is used as the divisor, so the result stays accurate for every rotation.
+		 *
+		 * @return The quaternion.
+		 */
+		static Quaternion FromRotation(
+			float m00, float m01, float m02,
+			float m10, float m11, float m12,
+			float m20, float m21, float m22)
+		{
+			const float trace = m00 + m11 + m22;
+			if (trace > 0.0f)
+			{
+				const float scale = 0.5f / std::sqrt(trace + 1.0f);
+				return Quaternion((m21 - m12) * scale, (m02 - m20) * scale, (m10 - m01) * scale, 0.25f / scale);
+			}
+
+			if (m00 > m11 && m00 > m22)
+			{
+				const float scale = 2.0f * std::sqrt(1.0f + m00 - m11 - m22);
+				return Quaternion(0.25f * scale, (m01 + m10) / scale, (m02 + m20) / scale, (m21 - m12) / scale);
+			}
+
+			if (m11 > m22)
+			{
+				const float scale = 2.0f * std::sqrt(1.0f + m11 - m00 - m22);
+				return Quaternion((m01 + m10) / scale, 0.25f * scale, (m12 + m21) / scale, (m02 - m20) / scale);
+			}
+
+			const float scale = 2.0f * std::sqrt(1.0f + m22 - m00 - m11);
+			return Quaternion((m02 + m20) / scale, (m12 + m21) / scale, 0.25f * scale, (m10 - m01) / scale);
+		}
+
+	public:
+		union
+		{
+			struct
+			{
+				float x, y, z, w;
+			};
+
+			IntrinsicTraits<float, 4>::Type intrinsic;
+		};
+	};
+
+	static_assert(sizeof(Quaternion) == 16, "Invalid Quaternion size.");
+	static_assert(alignof(Quaternion) == 16, "Invalid Quaternion alignment.");
+	static_assert(std::is_trivially_copyable<Quaternion>::value, "Quaternion must be trivially copyable.");
+}
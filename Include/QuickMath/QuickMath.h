@@ -6,10 +6,38 @@
  * This header includes all the header files in QuickMath.
  */
 
+#include "Animation/Pose.h"
+#include "Animation/Skinning.h"
+
+#include "Dispatch/Batch.h"
+
+#include "Matrix/Float3x3.h"
 #include "Matrix/Matrix22.h"
 #include "Matrix/Matrix33.h"
 #include "Matrix/Matrix44.h"
+#include "Matrix/Matrix44d.h"
+#include "Matrix/Transform3x4.h"
+
+#include "Packet/Matrix44Packet.h"
+#include "Packet/Packet.h"
+#include "Packet/Vector3Packet.h"
+#include "Packet/Vector4Packet.h"
+
+#include "Quaternion/DualQuaternion.h"
+#include "Quaternion/Quaternion.h"
+
+#include "Stream/Vector3Stream.h"
+#include "Stream/Vector4Stream.h"
 
+#include "Vector/Float3.h"
+#include "Vector/Half3.h"
+#include "Vector/Half4.h"
+#include "Vector/NormalEncoding.h"
 #include "Vector/Vector2.h"
 #include "Vector/Vector3.h"
+#include "Vector/Vector3d.h"
+#include "Vector/Vector3i.h"
 #include "Vector/Vector4.h"
+#include "Vector/Vector4d.h"
+#include "Vector/Vector4i.h"
+#include "Vector/VectorExpression.h"
@@ -0,0 +1,87 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "../IncludeSIMD.h"
+
+#include <cstddef>
+#include <new>
+
+namespace QuickMath
+{
+	/**
+	 * Allocator which returns memory aligned to a fixed boundary.
+	 * This is used for the structure-of-arrays buffers, so that they can be loaded with aligned packet loads.
+	 *
+	 * @tparam Type: The value type.
+	 * @tparam Alignment: The alignment in bytes.
+	 */
+	template<class Type, size_t Alignment>
+	class AlignedAllocator
+	{
+	public:
+		typedef Type value_type;
+
+		/**
+		 * Rebind the allocator to another type.
+		 *
+		 * @tparam Other: The other value type.
+		 */
+		template<class Other>
+		struct rebind { typedef AlignedAllocator<Other, Alignment> other; };
+
+		AlignedAllocator() = default;
+
+		/**
+		 * Construct the allocator using an allocator of another type.
+		 *
+		 * @param : The other allocator.
+		 */
+		template<class Other>
+		AlignedAllocator(const AlignedAllocator<Other, Alignment>&) {}
+
+		/**
+		 * Allocate memory.
+		 *
+		 * @param count: The number of elements.
+		 * @return The aligned memory.
+		 */
+		Type* allocate(size_t count)
+		{
+			void* pointer = _mm_malloc(count * sizeof(Type), Alignment);
+			if (!pointer)
+				throw std::bad_alloc();
+
+			return static_cast<Type*>(pointer);
+		}
+
+		/**
+		 * Free memory.
+		 *
+		 * @param pointer: The memory returned by allocate.
+		 * @param : The number of elements.
+		 */
+		void deallocate(Type* pointer, size_t)
+		{
+			_mm_free(pointer);
+		}
+
+		/**
+		 * Is equal operator. All the allocators are interchangeable.
+		 *
+		 * @param : RHS argument.
+		 * @return Boolean value.
+		 */
+		template<class Other>
+		bool operator==(const AlignedAllocator<Other, Alignment>&) const { return true; }
+
+		/**
+		 * Is not equal operator. All the allocators are interchangeable.
+		 *
+		 * @param : RHS argument.
+		 * @return Boolean value.
+		 */
+		template<class Other>
+		bool operator!=(const AlignedAllocator<Other, Alignment>&) const { return false; }
+	};
+}
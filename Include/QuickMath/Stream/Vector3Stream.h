@@ -0,0 +1,64 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "VectorStream.h"
+#include "../Vector/Vector3.h"
+
+namespace QuickMath
+{
+	/**
+	 * Structure-of-arrays Vector3 container.
+	 * The x, y and z components are stored in separate arrays. The w lanes of the vectors are not stored.
+	 */
+	class Vector3Stream final : public VectorStream<Vector3Stream, Vector3, 3>
+	{
+	public:
+		Vector3Stream() = default;
+
+		/**
+		 * Construct the stream with a number of zero vectors.
+		 *
+		 * @param size: The number of vectors.
+		 */
+		explicit Vector3Stream(size_t size) { Resize(size); }
+
+		/**
+		 * Construct the stream by gathering an array of vectors.
+		 *
+		 * @param vectors: The vectors.
+		 * @param count: The number of vectors.
+		 */
+		Vector3Stream(const Vector3* vectors, size_t count) { Load(vectors, count); }
+
+		/**
+		 * Construct the stream by gathering a vector array.
+		 *
+		 * @param vectors: The vectors.
+		 */
+		Vector3Stream(const std::vector<Vector3>& vectors) { Load(vectors.data(), vectors.size()); }
+
+		/**
+		 * Compute the cross products of this and another stream.
+		 *
+		 * @param other: The other stream. It must have the same size as this.
+		 * @return The cross product stream.
+		 */
+		Vector3Stream Cross(const Vector3Stream& other) const
+		{
+			Vector3Stream result(Size());
+			for (size_t i = 0; i < Stride(); i += NativePacket::Lanes)
+			{
+				const NativePacket x = NativePacket::LoadAligned(X() + i), otherX = NativePacket::LoadAligned(other.X() + i);
+				const NativePacket y = NativePacket::LoadAligned(Y() + i), otherY = NativePacket::LoadAligned(other.Y() + i);
+				const NativePacket z = NativePacket::LoadAligned(Z() + i), otherZ = NativePacket::LoadAligned(other.Z() + i);
+
+				y.MulSub(otherZ, z * otherY).StoreAligned(result.X() + i);
+				z.MulSub(otherX, x * otherZ).StoreAligned(result.Y() + i);
+				x.MulSub(otherY, y * otherX).StoreAligned(result.Z() + i);
+			}
+
+			return result;
+		}
+	};
+}
@@ -0,0 +1,55 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "VectorStream.h"
+#include "../Vector/Vector4.h"
+
+namespace QuickMath
+{
+	/**
+	 * Structure-of-arrays Vector4 container.
+	 * The x, y, z and w components are stored in separate arrays.
+	 */
+	class Vector4Stream final : public VectorStream<Vector4Stream, Vector4, 4>
+	{
+	public:
+		Vector4Stream() = default;
+
+		/**
+		 * Construct the stream with a number of zero vectors.
+		 *
+		 * @param size: The number of vectors.
+		 */
+		explicit Vector4Stream(size_t size) { Resize(size); }
+
+		/**
+		 * Construct the stream by gathering an array of vectors.
+		 *
+		 * @param vectors: The vectors.
+		 * @param count: The number of vectors.
+		 */
+		Vector4Stream(const Vector4* vectors, size_t count) { Load(vectors, count); }
+
+		/**
+		 * Construct the stream by gathering a vector array.
+		 *
+		 * @param vectors: The vectors.
+		 */
+		Vector4Stream(const std::vector<Vector4>& vectors) { Load(vectors.data(), vectors.size()); }
+
+		/**
+		 * Get the w component array.
+		 *
+		 * @return The 64 byte aligned array.
+		 */
+		float* W() { return Component(3); }
+
+		/**
+		 * Get the w component array.
+		 *
+		 * @return The 64 byte aligned array.
+		 */
+		const float* W() const { return Component(3); }
+	};
+}
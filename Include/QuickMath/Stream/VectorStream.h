@@ -0,0 +1,401 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "AlignedAllocator.h"
+#include "../Packet/Packet.h"
+
+#include <vector>
+
+namespace QuickMath
+{
+	/**
+	 * Structure-of-arrays vector container base class.
+	 * This holds the component arrays and contains all the common methods and operators of the vector streams.
+	 * The components are stored in separate 64 byte aligned arrays, so the kernels process NativePacket::Lanes vectors (4, 8 or 16
+	 * depending on the instruction set) per instruction without any shuffles.
+	 * The arrays are padded to a multiple of 16 elements. The padding lanes are computed along with the rest, so they can hold
+	 * any value (NaN included). Resize clears the ones which become vectors.
+	 *
+	 * @tparam Type: Stream Type.
+	 * @tparam VectorType: The vector type.
+	 * @tparam Components: The number of stored components (3 or 4).
+	 */
+	template<class Type, class VectorType, size_t Components>
+	class VectorStream
+	{
+	public:
+		/**
+		 * The buffer type of the component arrays and the per element results.
+		 */
+		typedef std::vector<float, AlignedAllocator<float, PacketAlignment>> Buffer;
+
+		/**
+		 * Get the number of vectors in the stream.
+		 *
+		 * @return The size.
+		 */
+		size_t Size() const { return size; }
+
+		/**
+		 * Get the padded length of each component array.
+		 *
+		 * @return The stride in elements.
+		 */
+		size_t Stride() const { return stride; }
+
+		/**
+		 * Resize the stream. The existing vectors are kept, and the new vectors are zero.
+		 *
+		 * @param newSize: The new number of vectors.
+		 */
+		void Resize(size_t newSize)
+		{
+			const size_t newStride = (newSize + 15) & ~size_t(15);
+			const size_t copyCount = newSize < size ? newSize : size;
+			if (newStride != stride)
+			{
+				Buffer newBuffer(newStride * Components, 0.0f);
+				for (size_t component = 0; component < Components; component++)
+					std::copy(Component(component), Component(component) + copyCount, newBuffer.data() + component * newStride);
+
+				buffer.swap(newBuffer);
+				stride = newStride;
+			}
+
+			for (size_t component = 0; component < Components; component++)
+				std::fill(Component(component) + copyCount, Component(component) + stride, 0.0f);
+
+			size = newSize;
+		}
+
+		/**
+		 * Get a component array.
+		 *
+		 * @param component: The index of the component.
+		 * @return The 64 byte aligned array.
+		 */
+		float* Component(size_t component) { return buffer.data() + component * stride; }
+
+		/**
+		 * Get a component array.
+		 *
+		 * @param component: The index of the component.
+		 * @return The 64 byte aligned array.
+		 */
+		const float* Component(size_t component) const { return buffer.data() + component * stride; }
+
+		/**
+		 * Get the x component array.
+		 *
+		 * @return The 64 byte aligned array.
+		 */
+		float* X() { return Component(0); }
+
+		/**
+		 * Get the x component array.
+		 *
+		 * @return The 64 byte aligned array.
+		 */
+		const float* X() const { return Component(0); }
+
+		/**
+		 * Get the y component array.
+		 *
+		 * @return The 64 byte aligned array.
+		 */
+		float* Y() { return Component(1); }
+
+		/**
+		 * Get the y component array.
+		 *
+		 * @return The 64 byte aligned array.
+		 */
+		const float* Y() const { return Component(1); }
+
+		/**
+		 * Get the z component array.
+		 *
+		 * @return The 64 byte aligned array.
+		 */
+		float* Z() { return Component(2); }
+
+		/**
+		 * Get the z component array.
+		 *
+		 * @return The 64 byte aligned array.
+		 */
+		const float* Z() const { return Component(2); }
+
+		/**
+		 * Get a vector from the stream. The components which are not stored are 0.
+		 *
+		 * @param index: The index of the vector.
+		 * @return The vector.
+		 */
+		VectorType Get(size_t index) const
+		{
+			VectorType vector;
+			for (size_t component = 0; component < Components; component++)
+				vector[static_cast<unsigned int>(component)] = Component(component)[index];
+
+			return vector;
+		}
+
+		/**
+		 * Set a vector in the stream.
+		 *
+		 * @param index: The index of the vector.
+		 * @param vector: The vector to set.
+		 */
+		void Set(size_t index, const VectorType& vector)
+		{
+			for (size_t component = 0; component < Components; component++)
+				Component(component)[index] = vector[static_cast<unsigned int>(component)];
+		}
+
+		/**
+		 * Gather an array of vectors into the stream. The stream is resized to the number of vectors. The components which are not
+		 * stored are dropped.
+		 * Four vectors are transposed at a time with _MM_TRANSPOSE4_PS.
+		 *
+		 * @param vectors: The vectors.
+		 * @param count: The number of vectors.
+		 */
+		void Load(const VectorType* vectors, size_t count)
+		{
+			Resize(count);
+
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 rows[4] = { vectors[i].intrinsic, vectors[i + 1].intrinsic, vectors[i + 2].intrinsic, vectors[i + 3].intrinsic };
+				_MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+
+				for (size_t component = 0; component < Components; component++)
+					_mm_store_ps(Component(component) + i, rows[component]);
+			}
+
+			for (; i < count; i++)
+				Set(i, vectors[i]);
+		}
+
+		/**
+		 * Scatter the stream to an array of vectors. The components which are not stored are set to 0.
+		 * Four vectors are transposed at a time with _MM_TRANSPOSE4_PS.
+		 *
+		 * @param vectors: The array to store to. It must hold Size() vectors.
+		 */
+		void Store(VectorType* vectors) const
+		{
+			size_t i = 0;
+			for (; i + 4 <= size; i += 4)
+			{
+				__m128 rows[4] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+				for (size_t component = 0; component < Components; component++)
+					rows[component] = _mm_load_ps(Component(component) + i);
+
+				_MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+
+				vectors[i].intrinsic = rows[0];
+				vectors[i + 1].intrinsic = rows[1];
+				vectors[i + 2].intrinsic = rows[2];
+				vectors[i + 3].intrinsic = rows[3];
+			}
+
+			for (; i < size; i++)
+				vectors[i] = Get(i);
+		}
+
+		/**
+		 * Scatter the stream to a vector array.
+		 *
+		 * @return The vector array.
+		 */
+		std::vector<VectorType> ToVector() const
+		{
+			std::vector<VectorType> vectors(size);
+			Store(vectors.data());
+			return vectors;
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param other: RHS argument. It must have the same size as this.
+		 * @return The calculated stream.
+		 */
+		Type operator+(const Type& other) const
+		{
+			Type result(size);
+			for (size_t i = 0; i < buffer.size(); i += NativePacket::Lanes)
+				(NativePacket::LoadAligned(buffer.data() + i) + NativePacket::LoadAligned(other.buffer.data() + i)).StoreAligned(result.buffer.data() + i);
+
+			return result;
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param other: RHS argument. It must have the same size as this.
+		 * @return The calculated stream.
+		 */
+		Type operator-(const Type& other) const
+		{
+			Type result(size);
+			for (size_t i = 0; i < buffer.size(); i += NativePacket::Lanes)
+				(NativePacket::LoadAligned(buffer.data() + i) - NativePacket::LoadAligned(other.buffer.data() + i)).StoreAligned(result.buffer.data() + i);
+
+			return result;
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param other: RHS argument. It must have the same size as this.
+		 * @return The calculated stream.
+		 */
+		Type operator*(const Type& other) const
+		{
+			Type result(size);
+			for (size_t i = 0; i < buffer.size(); i += NativePacket::Lanes)
+				(NativePacket::LoadAligned(buffer.data() + i) * NativePacket::LoadAligned(other.buffer.data() + i)).StoreAligned(result.buffer.data() + i);
+
+			return result;
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param other: RHS argument. It must have the same size as this.
+		 * @return The calculated stream.
+		 */
+		Type operator/(const Type& other) const
+		{
+			Type result(size);
+			for (size_t i = 0; i < buffer.size(); i += NativePacket::Lanes)
+				(NativePacket::LoadAligned(buffer.data() + i) / NativePacket::LoadAligned(other.buffer.data() + i)).StoreAligned(result.buffer.data() + i);
+
+			return result;
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated stream.
+		 */
+		Type operator*(const float& value) const
+		{
+			Type result(size);
+			const NativePacket packet(value);
+			for (size_t i = 0; i < buffer.size(); i += NativePacket::Lanes)
+				(NativePacket::LoadAligned(buffer.data() + i) * packet).StoreAligned(result.buffer.data() + i);
+
+			return result;
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated stream.
+		 */
+		Type operator/(const float& value) const
+		{
+			Type result(size);
+			const NativePacket packet(value);
+			for (size_t i = 0; i < buffer.size(); i += NativePacket::Lanes)
+				(NativePacket::LoadAligned(buffer.data() + i) / packet).StoreAligned(result.buffer.data() + i);
+
+			return result;
+		}
+
+		/**
+		 * Compute the dot products of this and another stream.
+		 *
+		 * @param other: The other stream. It must have the same size as this.
+		 * @return The dot product of each vector.
+		 */
+		Buffer Dot(const Type& other) const
+		{
+			Buffer result(stride);
+			for (size_t i = 0; i < stride; i += NativePacket::Lanes)
+				DotPackets(other, i).StoreAligned(result.data() + i);
+
+			result.resize(size);
+			return result;
+		}
+
+		/**
+		 * Compute the squared lengths of the vectors.
+		 *
+		 * @return The squared length of each vector.
+		 */
+		Buffer LengthSquared() const
+		{
+			Buffer result(stride);
+			for (size_t i = 0; i < stride; i += NativePacket::Lanes)
+				DotPackets(*this, i).StoreAligned(result.data() + i);
+
+			result.resize(size);
+			return result;
+		}
+
+		/**
+		 * Compute the lengths of the vectors.
+		 *
+		 * @return The length of each vector.
+		 */
+		Buffer Length() const
+		{
+			Buffer result(stride);
+			for (size_t i = 0; i < stride; i += NativePacket::Lanes)
+				DotPackets(*this, i).Sqrt().StoreAligned(result.data() + i);
+
+			result.resize(size);
+			return result;
+		}
+
+		/**
+		 * Normalize the vectors. Zero length vectors result in NaN.
+		 *
+		 * @return The normalized stream.
+		 */
+		Type Normalize() const
+		{
+			Type result(size);
+			for (size_t i = 0; i < stride; i += NativePacket::Lanes)
+			{
+				const NativePacket length = DotPackets(*this, i).Sqrt();
+				for (size_t component = 0; component < Components; component++)
+					(NativePacket::LoadAligned(Component(component) + i) / length).StoreAligned(result.Component(component) + i);
+			}
+
+			return result;
+		}
+
+	private:
+		/**
+		 * Compute the dot products of one packet of vectors.
+		 * The components are accumulated from the last one, so the products are x * x' + (y * y' + (z * z' + ...)).
+		 *
+		 * @param other: The other stream.
+		 * @param index: The index of the first vector of the packet.
+		 * @return The dot products.
+		 */
+		NativePacket DotPackets(const VectorStream& other, size_t index) const
+		{
+			NativePacket sum = NativePacket::LoadAligned(Component(Components - 1) + index) * NativePacket::LoadAligned(other.Component(Components - 1) + index);
+			for (size_t component = Components - 1; component-- > 0;)
+				sum = NativePacket::LoadAligned(Component(component) + index).MulAdd(NativePacket::LoadAligned(other.Component(component) + index), sum);
+
+			return sum;
+		}
+
+	private:
+		Buffer buffer;
+		size_t size = 0;
+		size_t stride = 0;
+	};
+}
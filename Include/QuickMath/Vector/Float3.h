@@ -0,0 +1,149 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Vector3.h"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * Packed 3D vector for QuickMath.
+	 * This is a storage type of three floats (12 bytes, without the hidden w of a Vector3), for arrays which are stored or sent as is.
+	 * Convert to a Vector3 to do math with it. The bulk conversions move four vectors through three registers with shuffles, so no
+	 * element is copied one float at a time.
+	 */
+	class Float3 final
+	{
+	public:
+		Float3() : x(0.0f), y(0.0f), z(0.0f) {}
+
+		/**
+		 * Construct the vector without initializing it.
+		 */
+		explicit Float3(UninitializedTag) {}
+
+		/**
+		 * Set values to all the components.
+		 *
+		 * @param value1: Value to be set to x.
+		 * @param value2: Value to be set to y.
+		 * @param value3: Value to be set to z.
+		 */
+		Float3(float value1, float value2, float value3) : x(value1), y(value2), z(value3) {}
+
+		/**
+		 * Construct the vector using a Vector3. The w component is dropped.
+		 *
+		 * @param vector: The vector.
+		 */
+		explicit Float3(const Vector3& vector) : x(vector.x), y(vector.y), z(vector.z) {}
+
+		/**
+		 * Convert the vector to a Vector3. The w component is 0.
+		 *
+		 * @return The vector.
+		 */
+		Vector3 ToVector3() const
+		{
+			return Vector3(x, y, z);
+		}
+
+		/**
+		 * Pack an array of Vector3s.
+		 *
+		 * @param input: The input vectors.
+		 * @param output: The packed vectors.
+		 * @param count: The number of vectors.
+		 */
+		static void Pack(const Vector3* input, Float3* output, size_t count)
+		{
+			size_t index = 0;
+			for (; index + 4 <= count; index += 4)
+			{
+				const __m128 vector0 = input[index].intrinsic;
+				const __m128 vector1 = input[index + 1].intrinsic;
+				const __m128 vector2 = input[index + 2].intrinsic;
+				const __m128 vector3 = input[index + 3].intrinsic;
+
+				// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+				const __m128 z0x1 = _mm_shuffle_ps(vector0, vector1, _MM_SHUFFLE(0, 0, 2, 2));
+				const __m128 z2x3 = _mm_shuffle_ps(vector2, vector3, _MM_SHUFFLE(0, 0, 2, 2));
+
+				float* destination = &output[index].x;
+				_mm_storeu_ps(destination, _mm_shuffle_ps(vector0, z0x1, _MM_SHUFFLE(2, 0, 1, 0)));
+				_mm_storeu_ps(destination + 4, _mm_shuffle_ps(vector1, vector2, _MM_SHUFFLE(1, 0, 2, 1)));
+				_mm_storeu_ps(destination + 8, _mm_shuffle_ps(z2x3, vector3, _MM_SHUFFLE(2, 1, 2, 0)));
+			}
+
+			for (; index < count; index++)
+				output[index] = Float3(input[index]);
+		}
+
+		/**
+		 * Unpack an array of vectors to Vector3s. The w components are 0.
+		 *
+		 * @param input: The packed vectors.
+		 * @param output: The output vectors.
+		 * @param count: The number of vectors.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		static void Unpack(const Float3* input, Vector3* output, size_t count, StoreMode mode = StoreMode::Cached)
+		{
+			if (mode == StoreMode::NonTemporal)
+			{
+				UnpackLoop<StoreMode::NonTemporal>(input, output, count);
+				_mm_sfence();
+			}
+			else
+				UnpackLoop<StoreMode::Cached>(input, output, count);
+		}
+
+	private:
+		/**
+		 * The unpack loop.
+		 *
+		 * @tparam Mode: The store mode.
+		 * @param input: The packed vectors.
+		 * @param output: The output vectors.
+		 * @param count: The number of vectors.
+		 */
+		template<StoreMode Mode>
+		static void UnpackLoop(const Float3* input, Vector3* output, size_t count)
+		{
+			const __m128 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+			size_t index = 0;
+			for (; index + 4 <= count; index += 4)
+			{
+				// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+				const float* source = &input[index].x;
+				const __m128 first = _mm_loadu_ps(source);
+				const __m128 second = _mm_loadu_ps(source + 4);
+				const __m128 third = _mm_loadu_ps(source + 8);
+
+				const __m128 x1y1 = _mm_shuffle_ps(first, second, _MM_SHUFFLE(0, 0, 3, 3));
+				const __m128 vector1 = _mm_shuffle_ps(x1y1, second, _MM_SHUFFLE(1, 1, 2, 0));
+				const __m128 vector2 = _mm_shuffle_ps(second, third, _MM_SHUFFLE(0, 0, 3, 2));
+				const __m128 vector3 = _mm_shuffle_ps(third, third, _MM_SHUFFLE(3, 3, 2, 1));
+
+				Intrinsics::Store<Mode>(&output[index].x, _mm_and_ps(first, mask));
+				Intrinsics::Store<Mode>(&output[index + 1].x, _mm_and_ps(vector1, mask));
+				Intrinsics::Store<Mode>(&output[index + 2].x, _mm_and_ps(vector2, mask));
+				Intrinsics::Store<Mode>(&output[index + 3].x, _mm_and_ps(vector3, mask));
+			}
+
+			for (; index < count; index++)
+				Intrinsics::Store<Mode>(&output[index].x, _mm_setr_ps(input[index].x, input[index].y, input[index].z, 0.0f));
+		}
+
+	public:
+		float x, y, z;
+	};
+
+	static_assert(sizeof(Float3) == 12, "Invalid Float3 size.");
+	static_assert(alignof(Float3) == 4, "Invalid Float3 alignment.");
+	static_assert(std::is_trivially_copyable<Float3>::value, "Float3 must be trivially copyable.");
+}
@@ -0,0 +1,122 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Vector3.h"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * Packed half precision 3D vector for QuickMath.
+	 * This is a storage type (6 bytes instead of the 16 of a Vector3, which has a hidden w), for large arrays which do not need the full
+	 * float precision. Convert to a Vector3 to do math with it. The conversions use F16C when it is available (F16C_INSTR_SET) and SSE2
+	 * otherwise.
+	 */
+	class Half3 final
+	{
+	public:
+		Half3() : x(0), y(0), z(0) {}
+
+		/**
+		 * Construct the vector without initializing it.
+		 */
+		explicit Half3(UninitializedTag) {}
+
+		/**
+		 * Construct the vector by rounding a Vector3 to half precision.
+		 *
+		 * @param vector: The vector.
+		 */
+		explicit Half3(const Vector3& vector)
+		{
+			const __m128i halves = Intrinsics::FloatToHalf(vector.intrinsic);
+			x = static_cast<unsigned short>(_mm_extract_epi16(halves, 0));
+			y = static_cast<unsigned short>(_mm_extract_epi16(halves, 1));
+			z = static_cast<unsigned short>(_mm_extract_epi16(halves, 2));
+		}
+
+		/**
+		 * Convert the vector to single precision. The w component is 0.
+		 *
+		 * @return The vector.
+		 */
+		Vector3 ToVector3() const
+		{
+			return Intrinsics::HalfToFloat(_mm_setr_epi16(static_cast<short>(x), static_cast<short>(y), static_cast<short>(z), 0, 0, 0, 0, 0));
+		}
+
+		/**
+		 * Round an array of Vector3s to half precision.
+		 * Every vector but the last is written with one 8 byte store, which spills into the next element before it is written.
+		 *
+		 * @param input: The input vectors.
+		 * @param output: The half vectors. It must not overlap the input.
+		 * @param count: The number of vectors.
+		 */
+		static void Pack(const Vector3* input, Half3* output, size_t count)
+		{
+			if (count == 0)
+				return;
+
+			for (size_t index = 0; index + 1 < count; index++)
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(output + index), Intrinsics::FloatToHalf(input[index].intrinsic));
+
+			output[count - 1] = Half3(input[count - 1]);
+		}
+
+		/**
+		 * Convert an array of half vectors to single precision. The w components are 0.
+		 * Every vector but the last is read with one 8 byte load, and the extra half is masked off.
+		 *
+		 * @param input: The half vectors.
+		 * @param output: The output vectors.
+		 * @param count: The number of vectors.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		static void Unpack(const Half3* input, Vector3* output, size_t count, StoreMode mode = StoreMode::Cached)
+		{
+			if (mode == StoreMode::NonTemporal)
+			{
+				UnpackLoop<StoreMode::NonTemporal>(input, output, count);
+				_mm_sfence();
+			}
+			else
+				UnpackLoop<StoreMode::Cached>(input, output, count);
+		}
+
+	private:
+		/**
+		 * The unpack loop.
+		 *
+		 * @tparam Mode: The store mode.
+		 * @param input: The half vectors.
+		 * @param output: The output vectors.
+		 * @param count: The number of vectors.
+		 */
+		template<StoreMode Mode>
+		static void UnpackLoop(const Half3* input, Vector3* output, size_t count)
+		{
+			if (count == 0)
+				return;
+
+			const __m128i mask = _mm_setr_epi16(-1, -1, -1, 0, 0, 0, 0, 0);
+			for (size_t index = 0; index + 1 < count; index++)
+			{
+				const __m128i halves = _mm_and_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + index)), mask);
+				Intrinsics::Store<Mode>(&output[index].x, Intrinsics::HalfToFloat(halves));
+			}
+
+			Intrinsics::Store<Mode>(&output[count - 1].x, input[count - 1].ToVector3().intrinsic);
+		}
+
+	public:
+		unsigned short x, y, z;
+	};
+
+	static_assert(sizeof(Half3) == 6, "Invalid Half3 size.");
+	static_assert(alignof(Half3) == 2, "Invalid Half3 alignment.");
+	static_assert(std::is_trivially_copyable<Half3>::value, "Half3 must be trivially copyable.");
+}
@@ -0,0 +1,135 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Vector4.h"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * Packed half precision 4D vector for QuickMath.
+	 * This is a storage type (8 bytes instead of the 16 of a Vector4), for large arrays which do not need the full float precision.
+	 * Convert to a Vector4 to do math with it. The conversions use F16C when it is available (F16C_INSTR_SET) and SSE2 otherwise.
+	 */
+	class Half4 final
+	{
+	public:
+		Half4() : x(0), y(0), z(0), w(0) {}
+
+		/**
+		 * Construct the vector without initializing it.
+		 */
+		explicit Half4(UninitializedTag) {}
+
+		/**
+		 * Construct the vector by rounding a Vector4 to half precision.
+		 *
+		 * @param vector: The vector.
+		 */
+		explicit Half4(const Vector4& vector)
+		{
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(this), Intrinsics::FloatToHalf(vector.intrinsic));
+		}
+
+		/**
+		 * Convert the vector to single precision.
+		 *
+		 * @return The vector.
+		 */
+		Vector4 ToVector4() const
+		{
+			return Intrinsics::HalfToFloat(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(this)));
+		}
+
+		/**
+		 * Round an array of Vector4s to half precision.
+		 * Two vectors are converted per instruction with AVX and F16C.
+		 *
+		 * @param input: The input vectors.
+		 * @param output: The half vectors.
+		 * @param count: The number of vectors.
+		 */
+		static void Pack(const Vector4* input, Half4* output, size_t count)
+		{
+			size_t index = 0;
+			for (; index + 2 <= count; index += 2)
+			{
+#if SSE_INSTR_SET > 6 && F16C_INSTR_SET > 0
+				const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(&input[index].x), _MM_FROUND_TO_NEAREST_INT);
+
+#else
+				const __m128i halves = _mm_unpacklo_epi64(Intrinsics::FloatToHalf(input[index].intrinsic), Intrinsics::FloatToHalf(input[index + 1].intrinsic));
+
+#endif // SSE_INSTR_SET > 6 && F16C_INSTR_SET > 0
+
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), halves);
+			}
+
+			if (index < count)
+				output[index] = Half4(input[index]);
+		}
+
+		/**
+		 * Convert an array of half vectors to single precision.
+		 * Two vectors are converted per instruction with AVX and F16C.
+		 *
+		 * @param input: The half vectors.
+		 * @param output: The output vectors.
+		 * @param count: The number of vectors.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		static void Unpack(const Half4* input, Vector4* output, size_t count, StoreMode mode = StoreMode::Cached)
+		{
+			if (mode == StoreMode::NonTemporal)
+			{
+				UnpackLoop<StoreMode::NonTemporal>(input, output, count);
+				_mm_sfence();
+			}
+			else
+				UnpackLoop<StoreMode::Cached>(input, output, count);
+		}
+
+	private:
+		/**
+		 * The unpack loop.
+		 *
+		 * @tparam Mode: The store mode.
+		 * @param input: The half vectors.
+		 * @param output: The output vectors.
+		 * @param count: The number of vectors.
+		 */
+		template<StoreMode Mode>
+		static void UnpackLoop(const Half4* input, Vector4* output, size_t count)
+		{
+			size_t index = 0;
+			for (; index + 2 <= count; index += 2)
+			{
+				const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index));
+
+#if SSE_INSTR_SET > 6 && F16C_INSTR_SET > 0
+				const __m256 floats = _mm256_cvtph_ps(halves);
+				Intrinsics::Store<Mode>(&output[index].x, _mm256_castps256_ps128(floats));
+				Intrinsics::Store<Mode>(&output[index + 1].x, _mm256_extractf128_ps(floats, 1));
+
+#else
+				Intrinsics::Store<Mode>(&output[index].x, Intrinsics::HalfToFloat(halves));
+				Intrinsics::Store<Mode>(&output[index + 1].x, Intrinsics::HalfToFloat(_mm_unpackhi_epi64(halves, halves)));
+
+#endif // SSE_INSTR_SET > 6 && F16C_INSTR_SET > 0
+			}
+
+			if (index < count)
+				Intrinsics::Store<Mode>(&output[index].x, input[index].ToVector4().intrinsic);
+		}
+
+	public:
+		unsigned short x, y, z, w;
+	};
+
+	static_assert(sizeof(Half4) == 8, "Invalid Half4 size.");
+	static_assert(alignof(Half4) == 2, "Invalid Half4 alignment.");
+	static_assert(std::is_trivially_copyable<Half4>::value, "Half4 must be trivially copyable.");
+}
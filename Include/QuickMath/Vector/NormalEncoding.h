@@ -0,0 +1,630 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Vector3.h"
+#include "../Precision.h"
+#include "../Stream/Vector3Stream.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * Shared loops of the compressed unit vector encodings (Octahedral16, Snorm16x3 and Snorm8x4).
+	 * Each encoding provides Encode4, which packs four vectors given as rows, and Decode4, which unpacks four encoded vectors to
+	 * structure-of-arrays registers, so the decoded vectors can go to a Vector3 array (one transpose) or to a Vector3Stream (none).
+	 */
+	namespace NormalEncoding
+	{
+		/**
+		 * Normalize four vectors held in structure-of-arrays registers.
+		 *
+		 * @param x: The x components.
+		 * @param y: The y components.
+		 * @param z: The z components.
+		 */
+		inline void Normalize(__m128& x, __m128& y, __m128& z)
+		{
+			const __m128 inverseLength = Precision::Exact::InverseSqrt(Intrinsics::MulAdd(z, z, Intrinsics::MulAdd(y, y, _mm_mul_ps(x, x))));
+			x = _mm_mul_ps(x, inverseLength);
+			y = _mm_mul_ps(y, inverseLength);
+			z = _mm_mul_ps(z, inverseLength);
+		}
+
+		/**
+		 * Sign extend the low 16 bits of each 32 bit lane and convert them to snorm floats (value / 32767, clamped to -1).
+		 *
+		 * @param value: The register, with the 16 bit values in the low halves of the lanes.
+		 * @return The floats.
+		 */
+		inline __m128 Snorm16ToFloat(__m128i value)
+		{
+			const __m128 scaled = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(value, 16), 16)), _mm_set1_ps(1.0f / 32767.0f));
+			return _mm_max_ps(scaled, _mm_set1_ps(-1.0f));
+		}
+
+		/**
+		 * Encode an array of vectors. The w lanes of the vectors are taken as 0.
+		 *
+		 * @tparam Encoding: The encoding type.
+		 * @param input: The input vectors.
+		 * @param output: The encoded vectors.
+		 * @param count: The number of vectors.
+		 */
+		template<class Encoding>
+		inline void Pack(const Vector3* input, Encoding* output, size_t count)
+		{
+			const __m128 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+			size_t index = 0;
+			for (; index + 4 <= count; index += 4)
+			{
+				const __m128 rows[4] = {
+					_mm_and_ps(input[index].intrinsic, mask),
+					_mm_and_ps(input[index + 1].intrinsic, mask),
+					_mm_and_ps(input[index + 2].intrinsic, mask),
+					_mm_and_ps(input[index + 3].intrinsic, mask) };
+
+				Encoding::Encode4(rows, output + index);
+			}
+
+			if (index < count)
+			{
+				__m128 rows[4] = { _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f), _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f), _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f), _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f) };
+				for (size_t tail = index; tail < count; tail++)
+					rows[tail - index] = _mm_and_ps(input[tail].intrinsic, mask);
+
+				Encoding encoded[4];
+				Encoding::Encode4(rows, encoded);
+				std::copy(encoded, encoded + (count - index), output + index);
+			}
+		}
+
+		/**
+		 * Decode four vectors and store them to a Vector3 array.
+		 *
+		 * @tparam Mode: The store mode.
+		 * @param input: The four encoded vectors.
+		 * @param output: The four vectors to store to.
+		 * @param lanes: The number of vectors to store (1 to 4).
+		 */
+		template<StoreMode Mode, class Encoding>
+		inline void DecodeAndStore(const Encoding* input, Vector3* output, size_t lanes)
+		{
+			__m128 x, y, z, w = _mm_setzero_ps();
+			Encoding::Decode4(input, x, y, z);
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			const __m128 rows[4] = { x, y, z, w };
+			for (size_t lane = 0; lane < lanes; lane++)
+				Intrinsics::Store<Mode>(&output[lane].x, rows[lane]);
+		}
+
+		/**
+		 * The decode loop.
+		 *
+		 * @tparam Mode: The store mode.
+		 * @param input: The encoded vectors.
+		 * @param output: The output vectors.
+		 * @param count: The number of vectors.
+		 */
+		template<StoreMode Mode, class Encoding>
+		inline void UnpackLoop(const Encoding* input, Vector3* output, size_t count)
+		{
+			size_t index = 0;
+			for (; index + 4 <= count; index += 4)
+				DecodeAndStore<Mode>(input + index, output + index, 4);
+
+			if (index < count)
+			{
+				Encoding encoded[4];
+				std::copy(input + index, input + count, encoded);
+				DecodeAndStore<Mode>(encoded, output + index, count - index);
+			}
+		}
+
+		/**
+		 * Decode an array of vectors.
+		 *
+		 * @tparam Encoding: The encoding type.
+		 * @param input: The encoded vectors.
+		 * @param output: The output vectors. The w components are 0.
+		 * @param count: The number of vectors.
+		 * @param mode: The store mode.
+		 */
+		template<class Encoding>
+		inline void Unpack(const Encoding* input, Vector3* output, size_t count, StoreMode mode)
+		{
+			if (mode == StoreMode::NonTemporal)
+			{
+				UnpackLoop<StoreMode::NonTemporal>(input, output, count);
+				_mm_sfence();
+			}
+			else
+				UnpackLoop<StoreMode::Cached>(input, output, count);
+		}
+
+		/**
+		 * Decode an array of vectors to a stream. The decoded registers are stored straight to the component arrays.
+		 *
+		 * @tparam Encoding: The encoding type.
+		 * @param input: The encoded vectors.
+		 * @param output: The output stream. It is resized to count.
+		 * @param count: The number of vectors.
+		 */
+		template<class Encoding>
+		inline void Unpack(const Encoding* input, Vector3Stream& output, size_t count)
+		{
+			output.Resize(count);
+
+			__m128 x, y, z;
+			size_t index = 0;
+			for (; index + 4 <= count; index += 4)
+			{
+				Encoding::Decode4(input + index, x, y, z);
+				_mm_store_ps(output.X() + index, x);
+				_mm_store_ps(output.Y() + index, y);
+				_mm_store_ps(output.Z() + index, z);
+			}
+
+			// The tail goes through a copy, so the padding of the stream stays zero.
+			if (index < count)
+			{
+				Encoding encoded[4];
+				std::copy(input + index, input + count, encoded);
+				Encoding::Decode4(encoded, x, y, z);
+
+				alignas(16) float components[3][4];
+				_mm_store_ps(components[0], x);
+				_mm_store_ps(components[1], y);
+				_mm_store_ps(components[2], z);
+				for (size_t tail = index; tail < count; tail++)
+					output.Set(tail, Vector3(components[0][tail - index], components[1][tail - index], components[2][tail - index]));
+			}
+		}
+	}
+
+	/**
+	 * Octahedral unit vector encoding in 2 x 16 bits (4 bytes instead of 16).
+	 * The unit sphere is projected onto an octahedron, which is unfolded onto a square and stored as two snorm16 values. This spreads
+	 * the precision evenly over the sphere, so it is the most accurate of the encodings per bit.
+	 * The largest angular error of an encode and decode round trip over 2M random unit vectors was 0.0037 degrees (6.5e-5 radians).
+	 * This is an empirical figure, not a proven bound.
+	 */
+	class Octahedral16 final
+	{
+	public:
+		Octahedral16() : x(0), y(0) {}
+
+		/**
+		 * Construct the encoded vector without initializing it.
+		 */
+		explicit Octahedral16(UninitializedTag) {}
+
+		/**
+		 * Encode a unit vector.
+		 *
+		 * @param vector: The unit vector.
+		 */
+		explicit Octahedral16(const Vector3& vector)
+		{
+			const __m128 rows[4] = { vector.intrinsic, vector.intrinsic, vector.intrinsic, vector.intrinsic };
+			Octahedral16 encoded[4];
+			Encode4(rows, encoded);
+			*this = encoded[0];
+		}
+
+		/**
+		 * Decode the vector.
+		 *
+		 * @return The unit vector. The w component is 0.
+		 */
+		Vector3 ToVector3() const
+		{
+			Vector3 vector(Uninitialized);
+			Unpack(this, &vector, 1);
+			return vector;
+		}
+
+		/**
+		 * Encode an array of unit vectors.
+		 *
+		 * @param input: The unit vectors.
+		 * @param output: The encoded vectors.
+		 * @param count: The number of vectors.
+		 */
+		static void Pack(const Vector3* input, Octahedral16* output, size_t count)
+		{
+			NormalEncoding::Pack(input, output, count);
+		}
+
+		/**
+		 * Decode an array of vectors.
+		 *
+		 * @param input: The encoded vectors.
+		 * @param output: The unit vectors. The w components are 0.
+		 * @param count: The number of vectors.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		static void Unpack(const Octahedral16* input, Vector3* output, size_t count, StoreMode mode = StoreMode::Cached)
+		{
+			NormalEncoding::Unpack(input, output, count, mode);
+		}
+
+		/**
+		 * Decode an array of vectors to a stream.
+		 *
+		 * @param input: The encoded vectors.
+		 * @param output: The stream of unit vectors. It is resized to count.
+		 * @param count: The number of vectors.
+		 */
+		static void Unpack(const Octahedral16* input, Vector3Stream& output, size_t count)
+		{
+			NormalEncoding::Unpack(input, output, count);
+		}
+
+		/**
+		 * Encode four unit vectors.
+		 *
+		 * @param rows: The vectors.
+		 * @param output: The four encoded vectors to store to.
+		 */
+		static void Encode4(const __m128 rows[4], Octahedral16* output)
+		{
+			__m128 x = rows[0], y = rows[1], z = rows[2], w = rows[3];
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			// Project onto the octahedron |x| + |y| + |z| = 1.
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+			const __m128 inverseNorm = _mm_div_ps(_mm_set1_ps(1.0f), _mm_add_ps(_mm_add_ps(_mm_andnot_ps(signMask, x), _mm_andnot_ps(signMask, y)), _mm_andnot_ps(signMask, z)));
+			x = _mm_mul_ps(x, inverseNorm);
+			y = _mm_mul_ps(y, inverseNorm);
+
+			// Fold the lower half over the diagonals: (1 - |y|, 1 - |x|) with the signs of x and y.
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 foldedX = _mm_or_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, y)), _mm_and_ps(signMask, x));
+			const __m128 foldedY = _mm_or_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, x)), _mm_and_ps(signMask, y));
+			const __m128 lower = _mm_cmplt_ps(z, _mm_setzero_ps());
+			x = _mm_or_ps(_mm_and_ps(lower, foldedX), _mm_andnot_ps(lower, x));
+			y = _mm_or_ps(_mm_and_ps(lower, foldedY), _mm_andnot_ps(lower, y));
+
+			// Round to snorm16 and interleave to x0, y0, x1, y1, ...
+			const __m128 scale = _mm_set1_ps(32767.0f);
+			const __m128i quantizedX = _mm_cvtps_epi32(_mm_mul_ps(x, scale));
+			const __m128i quantizedY = _mm_cvtps_epi32(_mm_mul_ps(y, scale));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_packs_epi32(_mm_unpacklo_epi32(quantizedX, quantizedY), _mm_unpackhi_epi32(quantizedX, quantizedY)));
+		}
+
+		/**
+		 * Decode four vectors.
+		 *
+		 * @param input: The four encoded vectors.
+		 * @param x: The x components of the unit vectors.
+		 * @param y: The y components of the unit vectors.
+		 * @param z: The z components of the unit vectors.
+		 */
+		static void Decode4(const Octahedral16* input, __m128& x, __m128& y, __m128& z)
+		{
+			const __m128i encoded = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+			const __m128 low = NormalEncoding::Snorm16ToFloat(_mm_unpacklo_epi16(encoded, encoded));
+			const __m128 high = NormalEncoding::Snorm16ToFloat(_mm_unpackhi_epi16(encoded, encoded));
+			x = _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+			y = _mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+
+			// z = 1 - |x| - |y|. Where z is negative, unfold by moving x and y toward 0 by -z (each keeps its sign).
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+			z = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_andnot_ps(signMask, x)), _mm_andnot_ps(signMask, y));
+
+			const __m128 unfold = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), z), _mm_setzero_ps());
+			x = _mm_sub_ps(x, _mm_or_ps(unfold, _mm_and_ps(signMask, x)));
+			y = _mm_sub_ps(y, _mm_or_ps(unfold, _mm_and_ps(signMask, y)));
+
+			NormalEncoding::Normalize(x, y, z);
+		}
+
+	public:
+		short x, y;
+	};
+
+	/**
+	 * Snorm16 unit vector encoding in 3 x 16 bits (6 bytes instead of 16).
+	 * Each component is rounded to value * 32767. The decoded vector is renormalized.
+	 * The worst case angular error of an encode and decode round trip is 0.0015 degrees (2.7e-5 radians), which is the bound of rounding
+	 * each component by half a step (sqrt(3) * 0.5 / 32767).
+	 */
+	class Snorm16x3 final
+	{
+	public:
+		Snorm16x3() : x(0), y(0), z(0) {}
+
+		/**
+		 * Construct the encoded vector without initializing it.
+		 */
+		explicit Snorm16x3(UninitializedTag) {}
+
+		/**
+		 * Encode a unit vector.
+		 *
+		 * @param vector: The unit vector.
+		 */
+		explicit Snorm16x3(const Vector3& vector)
+		{
+			const __m128i quantized = Quantize(vector.intrinsic);
+			x = static_cast<short>(_mm_extract_epi16(quantized, 0));
+			y = static_cast<short>(_mm_extract_epi16(quantized, 1));
+			z = static_cast<short>(_mm_extract_epi16(quantized, 2));
+		}
+
+		/**
+		 * Decode the vector.
+		 *
+		 * @return The unit vector. The w component is 0.
+		 */
+		Vector3 ToVector3() const
+		{
+			Vector3 vector(Uninitialized);
+			Unpack(this, &vector, 1);
+			return vector;
+		}
+
+		/**
+		 * Encode an array of unit vectors.
+		 *
+		 * @param input: The unit vectors.
+		 * @param output: The encoded vectors.
+		 * @param count: The number of vectors.
+		 */
+		static void Pack(const Vector3* input, Snorm16x3* output, size_t count)
+		{
+			NormalEncoding::Pack(input, output, count);
+		}
+
+		/**
+		 * Decode an array of vectors.
+		 *
+		 * @param input: The encoded vectors.
+		 * @param output: The unit vectors. The w components are 0.
+		 * @param count: The number of vectors.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		static void Unpack(const Snorm16x3* input, Vector3* output, size_t count, StoreMode mode = StoreMode::Cached)
+		{
+			NormalEncoding::Unpack(input, output, count, mode);
+		}
+
+		/**
+		 * Decode an array of vectors to a stream.
+		 *
+		 * @param input: The encoded vectors.
+		 * @param output: The stream of unit vectors. It is resized to count.
+		 * @param count: The number of vectors.
+		 */
+		static void Unpack(const Snorm16x3* input, Vector3Stream& output, size_t count)
+		{
+			NormalEncoding::Unpack(input, output, count);
+		}
+
+		/**
+		 * Encode four unit vectors.
+		 *
+		 * @param rows: The vectors.
+		 * @param output: The four encoded vectors to store to.
+		 */
+		static void Encode4(const __m128 rows[4], Snorm16x3* output)
+		{
+			// The 8 byte stores spill 2 bytes into the next vector, which is written after. The last one is written exactly.
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(output), Quantize(rows[0]));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(output + 1), Quantize(rows[1]));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(output + 2), Quantize(rows[2]));
+
+			const __m128i last = Quantize(rows[3]);
+			output[3].x = static_cast<short>(_mm_extract_epi16(last, 0));
+			output[3].y = static_cast<short>(_mm_extract_epi16(last, 1));
+			output[3].z = static_cast<short>(_mm_extract_epi16(last, 2));
+		}
+
+		/**
+		 * Decode four vectors.
+		 *
+		 * @param input: The four encoded vectors.
+		 * @param x: The x components of the unit vectors.
+		 * @param y: The y components of the unit vectors.
+		 * @param z: The z components of the unit vectors.
+		 */
+		static void Decode4(const Snorm16x3* input, __m128& x, __m128& y, __m128& z)
+		{
+			// x0 y0 z0 x1 y1 z1 x2 y2 | z2 x3 y3 z3
+			const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+			const __m128i second = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + 2));
+			const __m128i last = _mm_srli_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(reinterpret_cast<const short*>(input + 3) - 1)), 2);
+
+			__m128 row0 = NormalEncoding::Snorm16ToFloat(_mm_unpacklo_epi16(first, first));
+			__m128 row1 = NormalEncoding::Snorm16ToFloat(_mm_unpacklo_epi16(_mm_srli_si128(first, 6), _mm_srli_si128(first, 6)));
+			__m128 row2 = NormalEncoding::Snorm16ToFloat(_mm_unpacklo_epi16(second, second));
+			__m128 row3 = NormalEncoding::Snorm16ToFloat(_mm_unpacklo_epi16(last, last));
+			_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+			x = row0;
+			y = row1;
+			z = row2;
+			NormalEncoding::Normalize(x, y, z);
+		}
+
+	private:
+		/**
+		 * Clamp a vector to [-1, 1] and round it to snorm16.
+		 *
+		 * @param vector: The vector.
+		 * @return The four 16 bit values, in the low 64 bits.
+		 */
+		static __m128i Quantize(__m128 vector)
+		{
+			const __m128 clamped = _mm_min_ps(_mm_max_ps(vector, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+			const __m128i quantized = _mm_cvtps_epi32(_mm_mul_ps(clamped, _mm_set1_ps(32767.0f)));
+			return _mm_packs_epi32(quantized, quantized);
+		}
+
+	public:
+		short x, y, z;
+	};
+
+	/**
+	 * Snorm8 unit vector encoding in 4 x 8 bits (4 bytes instead of 16).
+	 * Each component is rounded to value * 127. The decoded vector is renormalized. The fourth byte is free for an extra snorm value,
+	 * such as the handedness of a tangent frame, and is 0 when encoding from a Vector3.
+	 * The worst case angular error of an encode and decode round trip is 0.39 degrees (6.8e-3 radians), which is the bound of rounding
+	 * each component by half a step (sqrt(3) * 0.5 / 127).
+	 */
+	class Snorm8x4 final
+	{
+	public:
+		Snorm8x4() : x(0), y(0), z(0), w(0) {}
+
+		/**
+		 * Construct the encoded vector without initializing it.
+		 */
+		explicit Snorm8x4(UninitializedTag) {}
+
+		/**
+		 * Encode a unit vector and an extra value.
+		 *
+		 * @param vector: The unit vector.
+		 * @param extra: The value to store in w, in [-1, 1]. Default is 0.
+		 */
+		explicit Snorm8x4(const Vector3& vector, float extra = 0.0f)
+		{
+			const __m128 rows[4] = { WithExtra(vector.intrinsic, extra), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+			Snorm8x4 encoded[4];
+			Encode4(rows, encoded);
+			*this = encoded[0];
+		}
+
+		/**
+		 * Decode the vector.
+		 *
+		 * @return The unit vector. The w component is 0.
+		 */
+		Vector3 ToVector3() const
+		{
+			Vector3 vector(Uninitialized);
+			Unpack(this, &vector, 1);
+			return vector;
+		}
+
+		/**
+		 * Get the extra value stored in w.
+		 *
+		 * @return The value.
+		 */
+		float GetExtra() const
+		{
+			return std::max(w / 127.0f, -1.0f);
+		}
+
+		/**
+		 * Encode an array of unit vectors. The extra values are 0.
+		 *
+		 * @param input: The unit vectors.
+		 * @param output: The encoded vectors.
+		 * @param count: The number of vectors.
+		 */
+		static void Pack(const Vector3* input, Snorm8x4* output, size_t count)
+		{
+			NormalEncoding::Pack(input, output, count);
+		}
+
+		/**
+		 * Decode an array of vectors.
+		 *
+		 * @param input: The encoded vectors.
+		 * @param output: The unit vectors. The w components are 0.
+		 * @param count: The number of vectors.
+		 * @param mode: The store mode. Default is Cached.
+		 */
+		static void Unpack(const Snorm8x4* input, Vector3* output, size_t count, StoreMode mode = StoreMode::Cached)
+		{
+			NormalEncoding::Unpack(input, output, count, mode);
+		}
+
+		/**
+		 * Decode an array of vectors to a stream.
+		 *
+		 * @param input: The encoded vectors.
+		 * @param output: The stream of unit vectors. It is resized to count.
+		 * @param count: The number of vectors.
+		 */
+		static void Unpack(const Snorm8x4* input, Vector3Stream& output, size_t count)
+		{
+			NormalEncoding::Unpack(input, output, count);
+		}
+
+		/**
+		 * Encode four unit vectors. The w lanes of the rows are the extra values.
+		 *
+		 * @param rows: The vectors.
+		 * @param output: The four encoded vectors to store to.
+		 */
+		static void Encode4(const __m128 rows[4], Snorm8x4* output)
+		{
+			const __m128 minimum = _mm_set1_ps(-1.0f), maximum = _mm_set1_ps(1.0f), scale = _mm_set1_ps(127.0f);
+			__m128i quantized[4];
+			for (int row = 0; row < 4; row++)
+				quantized[row] = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(rows[row], minimum), maximum), scale));
+
+			const __m128i packed = _mm_packs_epi16(_mm_packs_epi32(quantized[0], quantized[1]), _mm_packs_epi32(quantized[2], quantized[3]));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output), packed);
+		}
+
+		/**
+		 * Decode four vectors.
+		 * Each 32 bit lane holds one encoded vector, so the components are pulled out with shifts, without any shuffles.
+		 *
+		 * @param input: The four encoded vectors.
+		 * @param x: The x components of the unit vectors.
+		 * @param y: The y components of the unit vectors.
+		 * @param z: The z components of the unit vectors.
+		 */
+		static void Decode4(const Snorm8x4* input, __m128& x, __m128& y, __m128& z)
+		{
+			const __m128i encoded = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+			const __m128 scale = _mm_set1_ps(1.0f / 127.0f), minimum = _mm_set1_ps(-1.0f);
+
+			x = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(encoded, 24), 24)), scale), minimum);
+			y = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(encoded, 16), 24)), scale), minimum);
+			z = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(encoded, 8), 24)), scale), minimum);
+			NormalEncoding::Normalize(x, y, z);
+		}
+
+	private:
+		/**
+		 * Replace the w lane of a vector.
+		 *
+		 * @param vector: The vector.
+		 * @param extra: The value of the w lane.
+		 * @return The vector.
+		 */
+		static __m128 WithExtra(__m128 vector, float extra)
+		{
+			const __m128 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+			return _mm_or_ps(_mm_and_ps(vector, mask), _mm_andnot_ps(mask, _mm_set1_ps(extra)));
+		}
+
+	public:
+		signed char x, y, z, w;
+	};
+
+	static_assert(sizeof(Octahedral16) == 4, "Invalid Octahedral16 size.");
+	static_assert(alignof(Octahedral16) == 2, "Invalid Octahedral16 alignment.");
+	static_assert(std::is_trivially_copyable<Octahedral16>::value, "Octahedral16 must be trivially copyable.");
+
+	static_assert(sizeof(Snorm16x3) == 6, "Invalid Snorm16x3 size.");
+	static_assert(alignof(Snorm16x3) == 2, "Invalid Snorm16x3 alignment.");
+	static_assert(std::is_trivially_copyable<Snorm16x3>::value, "Snorm16x3 must be trivially copyable.");
+
+	static_assert(sizeof(Snorm8x4) == 4, "Invalid Snorm8x4 size.");
+	static_assert(alignof(Snorm8x4) == 1, "Invalid Snorm8x4 alignment.");
+	static_assert(std::is_trivially_copyable<Snorm8x4>::value, "Snorm8x4 must be trivially copyable.");
+}
@@ -2,7 +2,9 @@
 
 #pragma once
 
-#include "../IncludeSIMD.h"
+#include "../Intrinsics.h"
+#include "../Precision.h"
+#include "VectorMask.h"
 #include <initializer_list>
 #include <algorithm>
 
@@ -11,6 +13,7 @@ namespace QuickMath
 	/**
 	 * Vector base class for the QuickMath vectors.
 	 * This class contains all the common methods and operators all the other vectors contain.
+	 * It has no data and no copy operations of its own, so the vectors stay trivially copyable and arrays of them copy with memcpy.
 	 *
 	 * @tparam Type: Vector Type.
 	 * @tparam ValueType: The primitive value type.
@@ -179,14 +182,6 @@ namespace QuickMath
 			return (*this)();
 		}
 
-		/**
-		 * Return this vector.
-		 *
-		 * @param :
-		 * @return This vector.
-		 */
-		Vector& operator=(const Vector&) { return *this; }
-
 		/**
 		 * Initialize the vector with 0.
 		 */
@@ -203,7 +198,7 @@ namespace QuickMath
 	 * @return The added vector.
 	 */
 	template <class Type, class ValueType>
-	Vector<Type, ValueType> operator+(const Vector<Type, ValueType>& lhs, const ValueType& rhs)
+	Type operator+(const Vector<Type, ValueType>& lhs, const ValueType& rhs)
 	{
 		return lhs() + Type(rhs);
 	}
@@ -218,7 +213,7 @@ namespace QuickMath
 	 * @return The added vector.
 	 */
 	template <class Type, class ValueType>
-	Vector<Type, ValueType> operator+(const ValueType& lhs, const Vector<Type, ValueType>& rhs)
+	Type operator+(const ValueType& lhs, const Vector<Type, ValueType>& rhs)
 	{
 		return Type(lhs) + rhs();
 	}
@@ -233,7 +228,7 @@ namespace QuickMath
 	 * @return The subtracted vector.
 	 */
 	template <class Type, class ValueType>
-	Vector<Type, ValueType> operator-(const Vector<Type, ValueType>& lhs, const ValueType& rhs)
+	Type operator-(const Vector<Type, ValueType>& lhs, const ValueType& rhs)
 	{
 		return lhs() - Type(rhs);
 	}
@@ -248,7 +243,7 @@ namespace QuickMath
 	 * @return The subtracted vector.
 	 */
 	template <class Type, class ValueType>
-	Vector<Type, ValueType> operator-(const ValueType& lhs, const Vector<Type, ValueType>& rhs)
+	Type operator-(const ValueType& lhs, const Vector<Type, ValueType>& rhs)
 	{
 		return Type(lhs) - rhs();
 	}
@@ -263,7 +258,7 @@ namespace QuickMath
 	 * @return The multiplied vector.
 	 */
 	template <class Type, class ValueType>
-	Vector<Type, ValueType> operator*(const Vector<Type, ValueType>& lhs, const ValueType& rhs)
+	Type operator*(const Vector<Type, ValueType>& lhs, const ValueType& rhs)
 	{
 		return lhs() * Type(rhs);
 	}
@@ -278,7 +273,7 @@ namespace QuickMath
 	 * @return The multiplied vector.
 	 */
 	template <class Type, class ValueType>
-	Vector<Type, ValueType> operator*(const ValueType& lhs, const Vector<Type, ValueType>& rhs)
+	Type operator*(const ValueType& lhs, const Vector<Type, ValueType>& rhs)
 	{
 		return Type(lhs) * rhs();
 	}
@@ -293,7 +288,7 @@ namespace QuickMath
 	 * @return The divided vector.
 	 */
 	template <class Type, class ValueType>
-	Vector<Type, ValueType> operator/(const Vector<Type, ValueType>& lhs, const ValueType& rhs)
+	Type operator/(const Vector<Type, ValueType>& lhs, const ValueType& rhs)
 	{
 		return lhs() / Type(rhs);
 	}
@@ -308,7 +303,7 @@ namespace QuickMath
 	 * @return The divided vector.
 	 */
 	template <class Type, class ValueType>
-	Vector<Type, ValueType> operator/(const ValueType& lhs, const Vector<Type, ValueType>& rhs)
+	Type operator/(const ValueType& lhs, const Vector<Type, ValueType>& rhs)
 	{
 		return Type(lhs) / rhs();
 	}
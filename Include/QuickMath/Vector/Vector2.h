@@ -4,16 +4,24 @@
 
 #include "Vector.h"
 
+#include <type_traits>
+
 namespace QuickMath
 {
 	/**
 	 * The 2D vector of QuickMath.
+	 * The vector is stored as two floats and the calculations are done in the low half of an SSE register.
 	 */
 	class Vector2 final : public Vector<Vector2, float>
 	{
 	public:
 		Vector2() : x(0.0f), y(0.0f) {}
 
+		/**
+		 * Construct the vector without initializing it.
+		 */
+		explicit Vector2(UninitializedTag) {}
+
 		/**
 		 * Construct using one value which will be set to all (x, y)/ (a, b)/ (width, height).
 		 *
@@ -29,6 +37,17 @@ namespace QuickMath
 		 */
 		Vector2(float value1, float value2) : x(value1), y(value2) {}
 
+		/**
+		 * Construct the vector using the low half of an intrinsic value.
+		 * The upper two lanes are discarded.
+		 *
+		 * @param intrinsic: The intrinsic value.
+		 */
+		Vector2(const IntrinsicTraits<float, 2>::Type& intrinsic)
+		{
+			_mm_storel_pi(reinterpret_cast<__m64*>(&x), intrinsic);
+		}
+
 		/**
 		 * Set data to the vector using an initializer list.
 		 * The list size should be equal to 2.
@@ -100,6 +119,29 @@ namespace QuickMath
 			return &x;
 		}
 
+		/**
+		 * Assign the low half of an intrinsic value to the vector.
+		 *
+		 * @param intrinsic: The intrinsic value to store.
+		 * @return The vector reference.
+		 */
+		Vector2& operator=(const IntrinsicTraits<float, 2>::Type& intrinsic)
+		{
+			_mm_storel_pi(reinterpret_cast<__m64*>(&x), intrinsic);
+			return *this;
+		}
+
+		/**
+		 * Load the vector into the low half of an intrinsic value.
+		 * The upper two lanes are set to 0.
+		 *
+		 * @return The intrinsic value.
+		 */
+		operator const IntrinsicTraits<float, 2>::Type() const
+		{
+			return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&x));
+		}
+
 		/**
 		 * Addition operator.
 		 *
@@ -108,7 +150,7 @@ namespace QuickMath
 		 */
 		Vector2 operator+(const Vector2& other) const
 		{
-			return Vector2(x + other.x, y + other.y);
+			return std::move(_mm_add_ps(*this, other));
 		}
 
 		/**
@@ -119,7 +161,7 @@ namespace QuickMath
 		 */
 		Vector2 operator-(const Vector2& other) const
 		{
-			return Vector2(x - other.x, y - other.y);
+			return std::move(_mm_sub_ps(*this, other));
 		}
 
 		/**
@@ -130,7 +172,7 @@ namespace QuickMath
 		 */
 		Vector2 operator*(const Vector2& other) const
 		{
-			return Vector2(x * other.x, y * other.y);
+			return std::move(_mm_mul_ps(*this, other));
 		}
 
 		/**
@@ -141,7 +183,9 @@ namespace QuickMath
 		 */
 		Vector2 operator/(const Vector2& other) const
 		{
-			return Vector2(x / other.x, y / other.y);
+			// Load the divisor with ones in the upper lanes so the unused lanes do not divide by zero.
+			const IntrinsicTraits<float, 2>::Type divisor = _mm_loadl_pi(_mm_set1_ps(1.0f), reinterpret_cast<const __m64*>(&other.x));
+			return std::move(_mm_div_ps(*this, divisor));
 		}
 
 		/**
@@ -188,6 +232,72 @@ namespace QuickMath
 			return *this / Vector2(value);
 		}
 
+		/**
+		 * Component-wise equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<2> Equal(const Vector2& other) const
+		{
+			return VectorMask<2>(_mm_cmpeq_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise not equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<2> NotEqual(const Vector2& other) const
+		{
+			return VectorMask<2>(_mm_cmpneq_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise less than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<2> Less(const Vector2& other) const
+		{
+			return VectorMask<2>(_mm_cmplt_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise less than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<2> LessEqual(const Vector2& other) const
+		{
+			return VectorMask<2>(_mm_cmple_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise greater than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<2> Greater(const Vector2& other) const
+		{
+			return VectorMask<2>(_mm_cmpgt_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise greater than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<2> GreaterEqual(const Vector2& other) const
+		{
+			return VectorMask<2>(_mm_cmpge_ps(*this, other));
+		}
+
 		/**
 		 * Is equal operator.
 		 *
@@ -326,4 +436,8 @@ namespace QuickMath
 			};
 		};
 	};
+
+	static_assert(sizeof(Vector2) == 8, "Invalid Vector2 size.");
+	static_assert(alignof(Vector2) == 4, "Invalid Vector2 alignment.");
+	static_assert(std::is_trivially_copyable<Vector2>::value, "Vector2 must be trivially copyable.");
 }
@@ -4,6 +4,8 @@
 
 #include "Vector.h"
 
+#include <type_traits>
+
 namespace QuickMath
 {
 	/**
@@ -15,12 +17,17 @@ namespace QuickMath
 	public:
 		Vector3() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
 
+		/**
+		 * Construct the vector without initializing it.
+		 */
+		explicit Vector3(UninitializedTag) {}
+
 		/**
 		 * Set one value to all the data stored.
 		 *
 		 * @param value: Value to be stored.
 		 */
-		Vector3(float value) : x(value), y(value), z(value), w(value) {}
+		Vector3(float value) : intrinsic(_mm_set1_ps(value)) {}
 
 		/**
 		 * Values to be set to the internal variables.
@@ -258,6 +265,150 @@ namespace QuickMath
 			return *this / Vector3(value);
 		}
 
+		/**
+		 * Multiply this by a vector and add another vector (this * multiplier + addend).
+		 * This compiles to a single fused multiply-add when FMA3 is available.
+		 *
+		 * @param multiplier: The vector to multiply with.
+		 * @param addend: The vector to add.
+		 * @return The calculated vector.
+		 */
+		Vector3 MulAdd(const Vector3& multiplier, const Vector3& addend) const
+		{
+			return std::move(Intrinsics::MulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a value and add a vector (this * multiplier + addend).
+		 * This compiles to a single fused multiply-add when FMA3 is available.
+		 *
+		 * @param multiplier: The value to multiply with.
+		 * @param addend: The vector to add.
+		 * @return The calculated vector.
+		 */
+		Vector3 MulAdd(const float& multiplier, const Vector3& addend) const
+		{
+			return std::move(Intrinsics::MulAdd(intrinsic, _mm_set1_ps(multiplier), addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a vector and subtract another vector (this * multiplier - subtrahend).
+		 * This compiles to a single fused multiply-subtract when FMA3 is available.
+		 *
+		 * @param multiplier: The vector to multiply with.
+		 * @param subtrahend: The vector to subtract.
+		 * @return The calculated vector.
+		 */
+		Vector3 MulSub(const Vector3& multiplier, const Vector3& subtrahend) const
+		{
+			return std::move(Intrinsics::MulSub(intrinsic, multiplier.intrinsic, subtrahend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a value and subtract a vector (this * multiplier - subtrahend).
+		 * This compiles to a single fused multiply-subtract when FMA3 is available.
+		 *
+		 * @param multiplier: The value to multiply with.
+		 * @param subtrahend: The vector to subtract.
+		 * @return The calculated vector.
+		 */
+		Vector3 MulSub(const float& multiplier, const Vector3& subtrahend) const
+		{
+			return std::move(Intrinsics::MulSub(intrinsic, _mm_set1_ps(multiplier), subtrahend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a vector and subtract the product from another vector (addend - this * multiplier).
+		 * This compiles to a single fused negated multiply-add when FMA3 is available.
+		 *
+		 * @param multiplier: The vector to multiply with.
+		 * @param addend: The vector to subtract the product from.
+		 * @return The calculated vector.
+		 */
+		Vector3 NegMulAdd(const Vector3& multiplier, const Vector3& addend) const
+		{
+			return std::move(Intrinsics::NegMulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a value and subtract the product from a vector (addend - this * multiplier).
+		 * This compiles to a single fused negated multiply-add when FMA3 is available.
+		 *
+		 * @param multiplier: The value to multiply with.
+		 * @param addend: The vector to subtract the product from.
+		 * @return The calculated vector.
+		 */
+		Vector3 NegMulAdd(const float& multiplier, const Vector3& addend) const
+		{
+			return std::move(Intrinsics::NegMulAdd(intrinsic, _mm_set1_ps(multiplier), addend.intrinsic));
+		}
+
+		/**
+		 * Component-wise equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<3> Equal(const Vector3& other) const
+		{
+			return VectorMask<3>(_mm_cmpeq_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise not equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<3> NotEqual(const Vector3& other) const
+		{
+			return VectorMask<3>(_mm_cmpneq_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise less than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<3> Less(const Vector3& other) const
+		{
+			return VectorMask<3>(_mm_cmplt_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise less than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<3> LessEqual(const Vector3& other) const
+		{
+			return VectorMask<3>(_mm_cmple_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise greater than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<3> Greater(const Vector3& other) const
+		{
+			return VectorMask<3>(_mm_cmpgt_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise greater than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<3> GreaterEqual(const Vector3& other) const
+		{
+			return VectorMask<3>(_mm_cmpge_ps(*this, other));
+		}
+
 		/**
 		 * Is equal operator.
 		 *
@@ -266,8 +417,7 @@ namespace QuickMath
 		 */
 		bool operator==(const Vector3& other) const
 		{
-			Vector3 vec = std::move(_mm_cmpeq_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return Equal(other).All();
 		}
 
 		/**
@@ -278,8 +428,7 @@ namespace QuickMath
 		 */
 		bool operator!=(const Vector3& other) const
 		{
-			Vector3 vec = std::move(_mm_cmpneq_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return NotEqual(other).Any();
 		}
 
 		/**
@@ -290,8 +439,7 @@ namespace QuickMath
 		 */
 		bool operator<(const Vector3& other) const
 		{
-			Vector3 vec = std::move(_mm_cmplt_ps(*this, other));
-			return ((vec.r) || (vec.g) || (vec.b) || (vec.a));
+			return Less(other).Any();
 		}
 
 		/**
@@ -302,8 +450,7 @@ namespace QuickMath
 		 */
 		bool operator<=(const Vector3& other) const
 		{
-			Vector3 vec = std::move(_mm_cmple_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return LessEqual(other).All();
 		}
 
 		/**
@@ -314,8 +461,7 @@ namespace QuickMath
 		 */
 		bool operator>(const Vector3& other) const
 		{
-			Vector3 vec = std::move(_mm_cmpgt_ps(*this, other));
-			return ((vec.r) || (vec.g) || (vec.b) || (vec.a));
+			return Greater(other).Any();
 		}
 
 		/**
@@ -326,8 +472,7 @@ namespace QuickMath
 		 */
 		bool operator>=(const Vector3& other) const
 		{
-			Vector3 vec = std::move(_mm_cmpge_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return GreaterEqual(other).All();
 		}
 
 		/**
@@ -338,8 +483,7 @@ namespace QuickMath
 		 */
 		bool operator&&(const Vector3& other) const
 		{
-			Vector3 vec = std::move(_mm_and_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return VectorMask<3>(_mm_cmpneq_ps(_mm_and_ps(*this, other), _mm_setzero_ps())).All();
 		}
 
 		/**
@@ -350,8 +494,7 @@ namespace QuickMath
 		 */
 		bool operator||(const Vector3& other) const
 		{
-			Vector3 vec = std::move(_mm_or_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return VectorMask<3>(_mm_cmpneq_ps(_mm_or_ps(*this, other), _mm_setzero_ps())).All();
 		}
 
 		/**
@@ -362,8 +505,7 @@ namespace QuickMath
 		 */
 		bool operator^(const Vector3& other) const
 		{
-			Vector3 vec = std::move(_mm_or_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return VectorMask<3>(_mm_cmpneq_ps(_mm_or_ps(*this, other), _mm_setzero_ps())).All();
 		}
 
 		/**
@@ -373,8 +515,7 @@ namespace QuickMath
 		 */
 		bool operator~() const
 		{
-			Vector3 vec = std::move(_mm_or_ps(*this, Vector3(-1.0f)));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return VectorMask<3>(_mm_cmpneq_ps(_mm_or_ps(*this, Vector3(-1.0f)), _mm_setzero_ps())).All();
 		}
 
 		/**
@@ -384,8 +525,142 @@ namespace QuickMath
 		 */
 		bool operator!() const
 		{
-			Vector3 vec = std::move(_mm_or_ps(*this, Vector3(0.0f)));
-			return ((vec.r == 0) && (vec.g == 0) && (vec.b == 0) && (vec.a == 0));
+			return VectorMask<3>(_mm_cmpeq_ps(*this, _mm_setzero_ps())).All();
+		}
+
+		/**
+		 * Compute the dot product of this and another vector.
+		 * The w component is ignored.
+		 *
+		 * @param other: The other vector.
+		 * @return The dot product.
+		 */
+		float Dot(const Vector3& other) const
+		{
+			return _mm_cvtss_f32(Intrinsics::Dot3(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Compute the dot product of this and another vector.
+		 * The result is splatted to all the lanes so it can be used directly in the next vector operation.
+		 *
+		 * @param other: The other vector.
+		 * @return The splatted dot product.
+		 */
+		Vector3 DotSplat(const Vector3& other) const
+		{
+			return std::move(Intrinsics::Dot3(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Compute the cross product of this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The cross product.
+		 */
+		Vector3 Cross(const Vector3& other) const
+		{
+			return std::move(Intrinsics::Cross3(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Get the squared length of the vector.
+		 *
+		 * @return The squared length.
+		 */
+		float LengthSquared() const
+		{
+			return Dot(*this);
+		}
+
+		/**
+		 * Get the length of the vector.
+		 *
+		 * @return The length.
+		 */
+		float Length() const
+		{
+			return _mm_cvtss_f32(_mm_sqrt_ss(Intrinsics::Dot3(intrinsic, intrinsic)));
+		}
+
+		/**
+		 * Get the length of the vector, splatted to all the lanes.
+		 *
+		 * @return The splatted length.
+		 */
+		Vector3 LengthSplat() const
+		{
+			return std::move(_mm_sqrt_ps(Intrinsics::Dot3(intrinsic, intrinsic)));
+		}
+
+		/**
+		 * Get the reciprocal of the length of the vector.
+		 *
+		 * @tparam Policy: The precision policy (Precision::Exact, Precision::Refined or Precision::Fast).
+		 * @return The reciprocal length.
+		 */
+		template<class Policy = Precision::Exact>
+		float InvLength() const
+		{
+			return _mm_cvtss_f32(Policy::InverseSqrt(Intrinsics::Dot3(intrinsic, intrinsic)));
+		}
+
+		/**
+		 * Get the reciprocal of the length of the vector, splatted to all the lanes.
+		 *
+		 * @tparam Policy: The precision policy (Precision::Exact, Precision::Refined or Precision::Fast).
+		 * @return The splatted reciprocal length.
+		 */
+		template<class Policy = Precision::Exact>
+		Vector3 InvLengthSplat() const
+		{
+			return std::move(Policy::InverseSqrt(Intrinsics::Dot3(intrinsic, intrinsic)));
+		}
+
+		/**
+		 * Get the unit vector in the direction of this vector.
+		 * Normalizing a zero length vector results in NaN.
+		 *
+		 * @tparam Policy: The precision policy (Precision::Exact, Precision::Refined or Precision::Fast).
+		 * @return The normalized vector.
+		 */
+		template<class Policy = Precision::Exact>
+		Vector3 Normalize() const
+		{
+			return std::move(Policy::Normalize(intrinsic, Intrinsics::Dot3(intrinsic, intrinsic)));
+		}
+
+		/**
+		 * Get the squared distance between this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The squared distance.
+		 */
+		float DistanceSquared(const Vector3& other) const
+		{
+			return ((*this) - other).LengthSquared();
+		}
+
+		/**
+		 * Get the distance between this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The distance.
+		 */
+		float Distance(const Vector3& other) const
+		{
+			return ((*this) - other).Length();
+		}
+
+		/**
+		 * Get the distance between this and another vector, splatted to all the lanes.
+		 *
+		 * @param other: The other vector.
+		 * @return The splatted distance.
+		 */
+		Vector3 DistanceSplat(const Vector3& other) const
+		{
+			return ((*this) - other).LengthSplat();
 		}
 
 	public:
@@ -409,4 +684,8 @@ namespace QuickMath
 			IntrinsicTraits<float, 3>::Type intrinsic;
 		};
 	};
+
+	static_assert(sizeof(Vector3) == 16, "Invalid Vector3 size.");
+	static_assert(alignof(Vector3) == 16, "Invalid Vector3 alignment.");
+	static_assert(std::is_trivially_copyable<Vector3>::value, "Vector3 must be trivially copyable.");
 }
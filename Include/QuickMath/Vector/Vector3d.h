@@ -0,0 +1,564 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Vector3.h"
+
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * Double precision 3D vector for QuickMath.
+	 * This class uses an AVX register (or two SSE2 registers) to carry out the necessary calculations.
+	 */
+	class Vector3d final : public Vector<Vector3d, double>
+	{
+	public:
+		Vector3d() : intrinsic(Intrinsics::Set1Double(0.0)) {}
+
+		/**
+		 * Construct the vector without initializing it.
+		 */
+		explicit Vector3d(UninitializedTag) {}
+
+		/**
+		 * Set one value to all the data stored.
+		 *
+		 * @param value: Value to be stored.
+		 */
+		Vector3d(double value) : intrinsic(Intrinsics::Set1Double(value)) {}
+
+		/**
+		 * Values to be set to the internal variables.
+		 *
+		 * @param value1: Value to be set to x/ r/ width.
+		 * @param value2: Value to be set to y/ g/ height.
+		 * @param value3: Value to be set to z/ b/ depth.
+		 */
+		Vector3d(double value1, double value2, double value3) : intrinsic(Intrinsics::SetDouble(value1, value2, value3, 0.0)) {}
+
+		/**
+		 * Construct the vector using an intrinsic value.
+		 *
+		 * @param intrinsic: The intrinsic value.
+		 */
+		Vector3d(const IntrinsicTraits<double, 3>::Type& intrinsic) : intrinsic(intrinsic) {}
+
+		/**
+		 * Construct the vector by widening a single precision vector.
+		 *
+		 * @param vector: The single precision vector.
+		 */
+		explicit Vector3d(const Vector3& vector) : intrinsic(Intrinsics::ToDouble(vector.intrinsic)) {}
+
+		/**
+		 * Construct the vector using an initializer list.
+		 * The size of the list should be equal to 3.
+		 *
+		 * @param list: The initializer list.
+		 */
+		Vector3d(std::initializer_list<double> list) : intrinsic(Intrinsics::Set1Double(0.0))
+		{
+			if ((list.size() > 3) || (list.size() < 3))
+				return;
+
+			std::copy(list.begin(), list.end(), &x);
+		}
+
+		/**
+		 * Construct the vector using a double pointer.
+		 *
+		 * @param ptr: The double pointer.
+		 */
+		Vector3d(const double* ptr) : intrinsic(Intrinsics::Set1Double(0.0))
+		{
+			std::copy(ptr, ptr + 3, &x);
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the data to be accessed.
+		 * @return Double value at the index.
+		 */
+		double operator[](unsigned int index) const
+		{
+			return (operator const double* ())[index];
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the data to be accessed.
+		 * @return Double value at the index.
+		 */
+		double& operator[](unsigned int index)
+		{
+			return const_cast<double&>((operator const double* ())[index]);
+		}
+
+		/**
+		 * Return the address of this since it can be accessed by the [] operator.
+		 *
+		 * @return The address of the first element.
+		 */
+		operator double* ()
+		{
+			return &x;
+		}
+
+		/**
+		 * Return the address of this since it can be accessed by the [] operator.
+		 *
+		 * @return The address of the first element.
+		 */
+		operator const double* () const
+		{
+			return &x;
+		}
+
+		/**
+		 * Assign an intrinsic value to the vector.
+		 *
+		 * @param intrinsic: The intrinsic value to store.
+		 * @return The vector reference.
+		 */
+		Vector3d& operator=(const IntrinsicTraits<double, 3>::Type& intrinsic)
+		{
+			this->intrinsic = intrinsic;
+			return *this;
+		}
+
+		/**
+		 * Return the stored intrinsic value.
+		 *
+		 * @return The const intrinsic value.
+		 */
+		operator const IntrinsicTraits<double, 3>::Type() const
+		{
+			return intrinsic;
+		}
+
+		/**
+		 * Narrow the vector to single precision (rounded to nearest).
+		 *
+		 * @return The single precision vector.
+		 */
+		Vector3 ToVector3() const
+		{
+			return Vector3(Intrinsics::ToFloat(intrinsic));
+		}
+
+		/**
+		 * Get the single precision offset of this vector from an origin.
+		 * The subtraction is done in double precision, so large world coordinates close to the origin (for example the camera) keep their precision.
+		 *
+		 * @param origin: The origin.
+		 * @return The single precision offset.
+		 */
+		Vector3 RelativeTo(const Vector3d& origin) const
+		{
+			return Vector3(Intrinsics::ToFloat(Intrinsics::Sub(intrinsic, origin.intrinsic)));
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector3d operator+(const Vector3d& other) const
+		{
+			return Vector3d(Intrinsics::Add(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector3d operator-(const Vector3d& other) const
+		{
+			return Vector3d(Intrinsics::Sub(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector3d operator*(const Vector3d& other) const
+		{
+			return Vector3d(Intrinsics::Mul(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector3d operator/(const Vector3d& other) const
+		{
+			return Vector3d(Intrinsics::Div(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector3d operator+(const double& value) const
+		{
+			return *this + Vector3d(value);
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector3d operator-(const double& value) const
+		{
+			return *this - Vector3d(value);
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector3d operator*(const double& value) const
+		{
+			return *this * Vector3d(value);
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector3d operator/(const double& value) const
+		{
+			return *this / Vector3d(value);
+		}
+
+		/**
+		 * Multiply this by a vector and add another vector (this * multiplier + addend).
+		 * This compiles to a single fused multiply-add when AVX and FMA3 are available.
+		 *
+		 * @param multiplier: The vector to multiply with.
+		 * @param addend: The vector to add.
+		 * @return The calculated vector.
+		 */
+		Vector3d MulAdd(const Vector3d& multiplier, const Vector3d& addend) const
+		{
+			return Vector3d(Intrinsics::MulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a value and add a vector (this * multiplier + addend).
+		 * This compiles to a single fused multiply-add when AVX and FMA3 are available.
+		 *
+		 * @param multiplier: The value to multiply with.
+		 * @param addend: The vector to add.
+		 * @return The calculated vector.
+		 */
+		Vector3d MulAdd(const double& multiplier, const Vector3d& addend) const
+		{
+			return Vector3d(Intrinsics::MulAdd(intrinsic, Intrinsics::Set1Double(multiplier), addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a vector and subtract another vector (this * multiplier - subtrahend).
+		 * This compiles to a single fused multiply-subtract when AVX and FMA3 are available.
+		 *
+		 * @param multiplier: The vector to multiply with.
+		 * @param subtrahend: The vector to subtract.
+		 * @return The calculated vector.
+		 */
+		Vector3d MulSub(const Vector3d& multiplier, const Vector3d& subtrahend) const
+		{
+			return Vector3d(Intrinsics::MulSub(intrinsic, multiplier.intrinsic, subtrahend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a value and subtract a vector (this * multiplier - subtrahend).
+		 * This compiles to a single fused multiply-subtract when AVX and FMA3 are available.
+		 *
+		 * @param multiplier: The value to multiply with.
+		 * @param subtrahend: The vector to subtract.
+		 * @return The calculated vector.
+		 */
+		Vector3d MulSub(const double& multiplier, const Vector3d& subtrahend) const
+		{
+			return Vector3d(Intrinsics::MulSub(intrinsic, Intrinsics::Set1Double(multiplier), subtrahend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a vector and subtract the product from another vector (addend - this * multiplier).
+		 * This compiles to a single fused negated multiply-add when AVX and FMA3 are available.
+		 *
+		 * @param multiplier: The vector to multiply with.
+		 * @param addend: The vector to subtract the product from.
+		 * @return The calculated vector.
+		 */
+		Vector3d NegMulAdd(const Vector3d& multiplier, const Vector3d& addend) const
+		{
+			return Vector3d(Intrinsics::NegMulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a value and subtract the product from a vector (addend - this * multiplier).
+		 * This compiles to a single fused negated multiply-add when AVX and FMA3 are available.
+		 *
+		 * @param multiplier: The value to multiply with.
+		 * @param addend: The vector to subtract the product from.
+		 * @return The calculated vector.
+		 */
+		Vector3d NegMulAdd(const double& multiplier, const Vector3d& addend) const
+		{
+			return Vector3d(Intrinsics::NegMulAdd(intrinsic, Intrinsics::Set1Double(multiplier), addend.intrinsic));
+		}
+
+		/**
+		 * Component-wise equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMaskd<3> Equal(const Vector3d& other) const
+		{
+			return VectorMaskd<3>(Intrinsics::CompareEqual(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Component-wise not equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMaskd<3> NotEqual(const Vector3d& other) const
+		{
+			return VectorMaskd<3>(Intrinsics::CompareNotEqual(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Component-wise less than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMaskd<3> Less(const Vector3d& other) const
+		{
+			return VectorMaskd<3>(Intrinsics::CompareLess(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Component-wise less than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMaskd<3> LessEqual(const Vector3d& other) const
+		{
+			return VectorMaskd<3>(Intrinsics::CompareLessEqual(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Component-wise greater than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMaskd<3> Greater(const Vector3d& other) const
+		{
+			return VectorMaskd<3>(Intrinsics::CompareGreater(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Component-wise greater than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMaskd<3> GreaterEqual(const Vector3d& other) const
+		{
+			return VectorMaskd<3>(Intrinsics::CompareGreaterEqual(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Is equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator==(const Vector3d& other) const
+		{
+			return Equal(other).All();
+		}
+
+		/**
+		 * Is not equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator!=(const Vector3d& other) const
+		{
+			return NotEqual(other).Any();
+		}
+
+		/**
+		 * Is less than operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator<(const Vector3d& other) const
+		{
+			return Less(other).Any();
+		}
+
+		/**
+		 * Is less than or equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator<=(const Vector3d& other) const
+		{
+			return LessEqual(other).All();
+		}
+
+		/**
+		 * Is grater than operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator>(const Vector3d& other) const
+		{
+			return Greater(other).Any();
+		}
+
+		/**
+		 * Is grater than or equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator>=(const Vector3d& other) const
+		{
+			return GreaterEqual(other).All();
+		}
+
+		/**
+		 * Compute the dot product of this and another vector.
+		 * The w component is ignored.
+		 *
+		 * @param other: The other vector.
+		 * @return The dot product.
+		 */
+		double Dot(const Vector3d& other) const
+		{
+			return Intrinsics::FirstLane(Intrinsics::Dot3(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Compute the cross product of this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The cross product.
+		 */
+		Vector3d Cross(const Vector3d& other) const
+		{
+			return Vector3d(Intrinsics::Cross3(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Get the squared length of the vector.
+		 *
+		 * @return The squared length.
+		 */
+		double LengthSquared() const
+		{
+			return Dot(*this);
+		}
+
+		/**
+		 * Get the length of the vector.
+		 *
+		 * @return The length.
+		 */
+		double Length() const
+		{
+			return Intrinsics::FirstLane(Intrinsics::Sqrt(Intrinsics::Dot3(intrinsic, intrinsic)));
+		}
+
+		/**
+		 * Get the unit vector in the direction of this vector.
+		 * Normalizing a zero length vector results in NaN.
+		 *
+		 * @return The normalized vector.
+		 */
+		Vector3d Normalize() const
+		{
+			return Vector3d(Intrinsics::Div(intrinsic, Intrinsics::Sqrt(Intrinsics::Dot3(intrinsic, intrinsic))));
+		}
+
+		/**
+		 * Get the squared distance between this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The squared distance.
+		 */
+		double DistanceSquared(const Vector3d& other) const
+		{
+			return ((*this) - other).LengthSquared();
+		}
+
+		/**
+		 * Get the distance between this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The distance.
+		 */
+		double Distance(const Vector3d& other) const
+		{
+			return ((*this) - other).Length();
+		}
+
+	public:
+		union
+		{
+			struct
+			{
+				double x, y, z, w;
+			};
+
+			struct
+			{
+				double r, g, b, a;
+			};
+
+			struct
+			{
+				double width, height, depth, zero;
+			};
+
+			IntrinsicTraits<double, 3>::Type intrinsic;
+		};
+	};
+
+	static_assert(sizeof(Vector3d) == 32, "Invalid Vector3d size.");
+	static_assert(alignof(Vector3d) == alignof(IntrinsicTraits<double, 4>::Type), "Invalid Vector3d alignment.");
+	static_assert(std::is_trivially_copyable<Vector3d>::value, "Vector3d must be trivially copyable.");
+}
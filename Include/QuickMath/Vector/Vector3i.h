@@ -0,0 +1,494 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Vector3.h"
+
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * Integer 3D Vector for QuickMath.
+	 * This class uses an SSE2 integer register to carry out the necessary calculations.
+	 */
+	class Vector3i final : public Vector<Vector3i, int>
+	{
+	public:
+		Vector3i() : intrinsic(_mm_setzero_si128()) {}
+
+		/**
+		 * Construct the vector without initializing it.
+		 */
+		explicit Vector3i(UninitializedTag) {}
+
+		/**
+		 * Set one value to all the data stored.
+		 *
+		 * @param value: Value to be stored.
+		 */
+		Vector3i(int value) : intrinsic(_mm_set1_epi32(value)) {}
+
+		/**
+		 * Values to be set to the internal variables.
+		 *
+		 * @param value1: Value to be set to x/ r/ width.
+		 * @param value2: Value to be set to y/ g/ height.
+		 * @param value3: Value to be set to z/ b/ depth.
+		 */
+		Vector3i(int value1, int value2, int value3) : intrinsic(_mm_setr_epi32(value1, value2, value3, 0)) {}
+
+		/**
+		 * Construct the vector using an intrinsic value.
+		 *
+		 * @param intrinsic: The intrinsic value.
+		 */
+		Vector3i(const IntrinsicTraits<int, 3>::Type& intrinsic) : intrinsic(intrinsic) {}
+
+		/**
+		 * Construct the vector by converting a float vector.
+		 * The values are truncated towards zero (_mm_cvttps_epi32), like a C cast.
+		 *
+		 * @param vector: The float vector.
+		 */
+		explicit Vector3i(const Vector3& vector) : intrinsic(_mm_cvttps_epi32(vector.intrinsic)) {}
+
+		/**
+		 * Construct the vector using an initializer list.
+		 * The size of the list should be equal to 3.
+		 *
+		 * @param list: The initializer list.
+		 */
+		Vector3i(std::initializer_list<int> list) : intrinsic(_mm_setzero_si128())
+		{
+			if ((list.size() > 3) || (list.size() < 3))
+				return;
+
+			std::copy(list.begin(), list.end(), &x);
+		}
+
+		/**
+		 * Construct the vector using an integer pointer.
+		 *
+		 * @param ptr: The integer pointer.
+		 */
+		Vector3i(const int* ptr) : intrinsic(_mm_setzero_si128())
+		{
+			std::copy(ptr, ptr + 3, &x);
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the data to be accessed.
+		 * @return Integer value at the index.
+		 */
+		int operator[](unsigned int index) const
+		{
+			return (operator const int* ())[index];
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the data to be accessed.
+		 * @return Integer value at the index.
+		 */
+		int& operator[](unsigned int index)
+		{
+			return const_cast<int&>((operator const int* ())[index]);
+		}
+
+		/**
+		 * Return the address of this since it can be accessed by the [] operator.
+		 *
+		 * @return The address of the first element.
+		 */
+		operator int* ()
+		{
+			return &x;
+		}
+
+		/**
+		 * Return the address of this since it can be accessed by the [] operator.
+		 *
+		 * @return The address of the first element.
+		 */
+		operator const int* () const
+		{
+			return &x;
+		}
+
+		/**
+		 * Assign an intrinsic value to the vector.
+		 *
+		 * @param intrinsic: The intrinsic value to store.
+		 * @return The vector reference.
+		 */
+		Vector3i& operator=(const IntrinsicTraits<int, 3>::Type& intrinsic)
+		{
+			this->intrinsic = intrinsic;
+			return *this;
+		}
+
+		/**
+		 * Return the stored intrinsic value.
+		 *
+		 * @return The const intrinsic value.
+		 */
+		operator const IntrinsicTraits<int, 3>::Type() const
+		{
+			return intrinsic;
+		}
+
+		/**
+		 * Convert the vector to a float vector (_mm_cvtepi32_ps).
+		 *
+		 * @return The float vector.
+		 */
+		Vector3 ToVector3() const
+		{
+			return Vector3(_mm_cvtepi32_ps(intrinsic));
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector3i operator+(const Vector3i& other) const
+		{
+			return Vector3i(_mm_add_epi32(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector3i operator-(const Vector3i& other) const
+		{
+			return Vector3i(_mm_sub_epi32(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Multiplication operator.
+		 * Only the low 32 bits of each product are kept, like the C multiplication.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector3i operator*(const Vector3i& other) const
+		{
+			return Vector3i(Intrinsics::MulLo(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Division operator.
+		 * There is no SIMD integer division, so this divides lane by lane.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector3i operator/(const Vector3i& other) const
+		{
+			Vector3i newVector;
+			newVector.x = x / other.x;
+			newVector.y = y / other.y;
+			newVector.z = z / other.z;
+
+			return newVector;
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector3i operator+(const int& value) const
+		{
+			return Vector3i(_mm_add_epi32(intrinsic, _mm_set1_epi32(value)));
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector3i operator-(const int& value) const
+		{
+			return Vector3i(_mm_sub_epi32(intrinsic, _mm_set1_epi32(value)));
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector3i operator*(const int& value) const
+		{
+			return Vector3i(Intrinsics::MulLo(intrinsic, _mm_set1_epi32(value)));
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector3i operator/(const int& value) const
+		{
+			return *this / Vector3i(value);
+		}
+
+		/**
+		 * Bitwise AND operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector3i operator&(const Vector3i& other) const
+		{
+			return Vector3i(_mm_and_si128(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Bitwise OR operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector3i operator|(const Vector3i& other) const
+		{
+			return Vector3i(_mm_or_si128(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Bitwise XOR operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector3i operator^(const Vector3i& other) const
+		{
+			return Vector3i(_mm_xor_si128(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Shift all the lanes left.
+		 *
+		 * @param count: The number of bits to shift by.
+		 * @return The shifted vector.
+		 */
+		Vector3i operator<<(int count) const
+		{
+			return Vector3i(_mm_slli_epi32(intrinsic, count));
+		}
+
+		/**
+		 * Shift all the lanes right, keeping the sign (arithmetic shift).
+		 *
+		 * @param count: The number of bits to shift by.
+		 * @return The shifted vector.
+		 */
+		Vector3i operator>>(int count) const
+		{
+			return Vector3i(_mm_srai_epi32(intrinsic, count));
+		}
+
+		/**
+		 * Shift all the lanes right, filling with zeros (logical shift).
+		 *
+		 * @param count: The number of bits to shift by.
+		 * @return The shifted vector.
+		 */
+		Vector3i ShiftRightLogical(int count) const
+		{
+			return Vector3i(_mm_srli_epi32(intrinsic, count));
+		}
+
+		/**
+		 * Get the component-wise minimum of this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The minimum vector.
+		 */
+		Vector3i Min(const Vector3i& other) const
+		{
+			return Vector3i(Intrinsics::Min(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Get the component-wise maximum of this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The maximum vector.
+		 */
+		Vector3i Max(const Vector3i& other) const
+		{
+			return Vector3i(Intrinsics::Max(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Component-wise equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<3> Equal(const Vector3i& other) const
+		{
+			return VectorMask<3>(_mm_castsi128_ps(_mm_cmpeq_epi32(intrinsic, other.intrinsic)));
+		}
+
+		/**
+		 * Component-wise not equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<3> NotEqual(const Vector3i& other) const
+		{
+			return ~Equal(other);
+		}
+
+		/**
+		 * Component-wise less than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<3> Less(const Vector3i& other) const
+		{
+			return VectorMask<3>(_mm_castsi128_ps(_mm_cmplt_epi32(intrinsic, other.intrinsic)));
+		}
+
+		/**
+		 * Component-wise less than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<3> LessEqual(const Vector3i& other) const
+		{
+			return ~Greater(other);
+		}
+
+		/**
+		 * Component-wise greater than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<3> Greater(const Vector3i& other) const
+		{
+			return VectorMask<3>(_mm_castsi128_ps(_mm_cmpgt_epi32(intrinsic, other.intrinsic)));
+		}
+
+		/**
+		 * Component-wise greater than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<3> GreaterEqual(const Vector3i& other) const
+		{
+			return ~Less(other);
+		}
+
+		/**
+		 * Is equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator==(const Vector3i& other) const
+		{
+			return Equal(other).All();
+		}
+
+		/**
+		 * Is not equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator!=(const Vector3i& other) const
+		{
+			return NotEqual(other).Any();
+		}
+
+		/**
+		 * Is less than operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator<(const Vector3i& other) const
+		{
+			return Less(other).Any();
+		}
+
+		/**
+		 * Is less than or equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator<=(const Vector3i& other) const
+		{
+			return LessEqual(other).All();
+		}
+
+		/**
+		 * Is grater than operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator>(const Vector3i& other) const
+		{
+			return Greater(other).Any();
+		}
+
+		/**
+		 * Is grater than or equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator>=(const Vector3i& other) const
+		{
+			return GreaterEqual(other).All();
+		}
+
+	public:
+		union
+		{
+			struct
+			{
+				int x, y, z, w;
+			};
+
+			struct
+			{
+				int r, g, b, a;
+			};
+
+			struct
+			{
+				int width, height, depth, zero;
+			};
+
+			IntrinsicTraits<int, 3>::Type intrinsic;
+		};
+	};
+
+	static_assert(sizeof(Vector3i) == 16, "Invalid Vector3i size.");
+	static_assert(alignof(Vector3i) == 16, "Invalid Vector3i alignment.");
+	static_assert(std::is_trivially_copyable<Vector3i>::value, "Vector3i must be trivially copyable.");
+}
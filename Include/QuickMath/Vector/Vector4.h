@@ -4,6 +4,8 @@
 
 #include "Vector.h"
 
+#include <type_traits>
+
 namespace QuickMath
 {
 	/**
@@ -15,12 +17,17 @@ namespace QuickMath
 	public:
 		Vector4() : r(0.0f), g(0.0f), b(0.0f), a(0.0f) {}
 
+		/**
+		 * Construct the vector without initializing it.
+		 */
+		explicit Vector4(UninitializedTag) {}
+
 		/**
 		 * Set data to all the variables using one value.
 		 *
 		 * @param value: The value to be set.
 		 */
-		Vector4(float value) : r(value), g(value), b(value), a(value) {}
+		Vector4(float value) : intrinsic(_mm_set1_ps(value)) {}
 
 		/**
 		 * Set values to all the variables.
@@ -256,7 +263,151 @@ namespace QuickMath
 		 */
 		Vector4 operator/(const float& value) const
 		{
-			return (*this) / +Vector4(value);
+			return (*this) / Vector4(value);
+		}
+
+		/**
+		 * Multiply this by a vector and add another vector (this * multiplier + addend).
+		 * This compiles to a single fused multiply-add when FMA3 is available.
+		 *
+		 * @param multiplier: The vector to multiply with.
+		 * @param addend: The vector to add.
+		 * @return The calculated vector.
+		 */
+		Vector4 MulAdd(const Vector4& multiplier, const Vector4& addend) const
+		{
+			return std::move(Intrinsics::MulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a value and add a vector (this * multiplier + addend).
+		 * This compiles to a single fused multiply-add when FMA3 is available.
+		 *
+		 * @param multiplier: The value to multiply with.
+		 * @param addend: The vector to add.
+		 * @return The calculated vector.
+		 */
+		Vector4 MulAdd(const float& multiplier, const Vector4& addend) const
+		{
+			return std::move(Intrinsics::MulAdd(intrinsic, _mm_set1_ps(multiplier), addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a vector and subtract another vector (this * multiplier - subtrahend).
+		 * This compiles to a single fused multiply-subtract when FMA3 is available.
+		 *
+		 * @param multiplier: The vector to multiply with.
+		 * @param subtrahend: The vector to subtract.
+		 * @return The calculated vector.
+		 */
+		Vector4 MulSub(const Vector4& multiplier, const Vector4& subtrahend) const
+		{
+			return std::move(Intrinsics::MulSub(intrinsic, multiplier.intrinsic, subtrahend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a value and subtract a vector (this * multiplier - subtrahend).
+		 * This compiles to a single fused multiply-subtract when FMA3 is available.
+		 *
+		 * @param multiplier: The value to multiply with.
+		 * @param subtrahend: The vector to subtract.
+		 * @return The calculated vector.
+		 */
+		Vector4 MulSub(const float& multiplier, const Vector4& subtrahend) const
+		{
+			return std::move(Intrinsics::MulSub(intrinsic, _mm_set1_ps(multiplier), subtrahend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a vector and subtract the product from another vector (addend - this * multiplier).
+		 * This compiles to a single fused negated multiply-add when FMA3 is available.
+		 *
+		 * @param multiplier: The vector to multiply with.
+		 * @param addend: The vector to subtract the product from.
+		 * @return The calculated vector.
+		 */
+		Vector4 NegMulAdd(const Vector4& multiplier, const Vector4& addend) const
+		{
+			return std::move(Intrinsics::NegMulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a value and subtract the product from a vector (addend - this * multiplier).
+		 * This compiles to a single fused negated multiply-add when FMA3 is available.
+		 *
+		 * @param multiplier: The value to multiply with.
+		 * @param addend: The vector to subtract the product from.
+		 * @return The calculated vector.
+		 */
+		Vector4 NegMulAdd(const float& multiplier, const Vector4& addend) const
+		{
+			return std::move(Intrinsics::NegMulAdd(intrinsic, _mm_set1_ps(multiplier), addend.intrinsic));
+		}
+
+		/**
+		 * Component-wise equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> Equal(const Vector4& other) const
+		{
+			return VectorMask<4>(_mm_cmpeq_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise not equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> NotEqual(const Vector4& other) const
+		{
+			return VectorMask<4>(_mm_cmpneq_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise less than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> Less(const Vector4& other) const
+		{
+			return VectorMask<4>(_mm_cmplt_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise less than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> LessEqual(const Vector4& other) const
+		{
+			return VectorMask<4>(_mm_cmple_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise greater than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> Greater(const Vector4& other) const
+		{
+			return VectorMask<4>(_mm_cmpgt_ps(*this, other));
+		}
+
+		/**
+		 * Component-wise greater than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> GreaterEqual(const Vector4& other) const
+		{
+			return VectorMask<4>(_mm_cmpge_ps(*this, other));
 		}
 
 		/**
@@ -267,8 +418,7 @@ namespace QuickMath
 		 */
 		bool operator==(const Vector4& other) const
 		{
-			Vector4 vec = std::move(_mm_cmpeq_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return Equal(other).All();
 		}
 
 		/**
@@ -279,8 +429,7 @@ namespace QuickMath
 		 */
 		bool operator!=(const Vector4& other) const
 		{
-			Vector4 vec = std::move(_mm_cmpneq_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return NotEqual(other).Any();
 		}
 
 		/**
@@ -291,8 +440,7 @@ namespace QuickMath
 		 */
 		bool operator<(const Vector4& other) const
 		{
-			Vector4 vec = std::move(_mm_cmplt_ps(*this, other));
-			return ((vec.r) || (vec.g) || (vec.b) || (vec.a));
+			return Less(other).Any();
 		}
 
 		/**
@@ -303,8 +451,7 @@ namespace QuickMath
 		 */
 		bool operator<=(const Vector4& other) const
 		{
-			Vector4 vec = std::move(_mm_cmple_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return LessEqual(other).All();
 		}
 
 		/**
@@ -315,8 +462,7 @@ namespace QuickMath
 		 */
 		bool operator>(const Vector4& other) const
 		{
-			Vector4 vec = std::move(_mm_cmpgt_ps(*this, other));
-			return ((vec.r) || (vec.g) || (vec.b) || (vec.a));
+			return Greater(other).Any();
 		}
 
 		/**
@@ -327,8 +473,7 @@ namespace QuickMath
 		 */
 		bool operator>=(const Vector4& other) const
 		{
-			Vector4 vec = std::move(_mm_cmpge_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return GreaterEqual(other).All();
 		}
 
 		/**
@@ -339,8 +484,7 @@ namespace QuickMath
 		 */
 		bool operator&&(const Vector4& other) const
 		{
-			Vector4 vec = std::move(_mm_and_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return VectorMask<4>(_mm_cmpneq_ps(_mm_and_ps(*this, other), _mm_setzero_ps())).All();
 		}
 
 		/**
@@ -351,8 +495,7 @@ namespace QuickMath
 		 */
 		bool operator||(const Vector4& other) const
 		{
-			Vector4 vec = std::move(_mm_or_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return VectorMask<4>(_mm_cmpneq_ps(_mm_or_ps(*this, other), _mm_setzero_ps())).All();
 		}
 
 		/**
@@ -363,8 +506,7 @@ namespace QuickMath
 		 */
 		bool operator^(const Vector4& other) const
 		{
-			Vector4 vec = std::move(_mm_or_ps(*this, other));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return VectorMask<4>(_mm_cmpneq_ps(_mm_or_ps(*this, other), _mm_setzero_ps())).All();
 		}
 
 		/**
@@ -374,8 +516,7 @@ namespace QuickMath
 		 */
 		bool operator~() const
 		{
-			Vector4 vec = std::move(_mm_or_ps(*this, Vector4(-1.0f)));
-			return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+			return VectorMask<4>(_mm_cmpneq_ps(_mm_or_ps(*this, Vector4(-1.0f)), _mm_setzero_ps())).All();
 		}
 
 		/**
@@ -385,8 +526,142 @@ namespace QuickMath
 		 */
 		bool operator!() const
 		{
-			Vector4 vec = std::move(_mm_or_ps(*this, Vector4(0.0f)));
-			return ((vec.r == 0) && (vec.g == 0) && (vec.b == 0) && (vec.a == 0));
+			return VectorMask<4>(_mm_cmpeq_ps(*this, _mm_setzero_ps())).All();
+		}
+
+		/**
+		 * Compute the dot product of this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The dot product.
+		 */
+		float Dot(const Vector4& other) const
+		{
+			return _mm_cvtss_f32(Intrinsics::Dot4(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Compute the dot product of this and another vector.
+		 * The result is splatted to all the lanes so it can be used directly in the next vector operation.
+		 *
+		 * @param other: The other vector.
+		 * @return The splatted dot product.
+		 */
+		Vector4 DotSplat(const Vector4& other) const
+		{
+			return std::move(Intrinsics::Dot4(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Compute the cross product of this and another vector.
+		 * This uses the x, y and z components and sets w to 0.
+		 *
+		 * @param other: The other vector.
+		 * @return The cross product.
+		 */
+		Vector4 Cross(const Vector4& other) const
+		{
+			return std::move(Intrinsics::Cross3(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Get the squared length of the vector.
+		 *
+		 * @return The squared length.
+		 */
+		float LengthSquared() const
+		{
+			return Dot(*this);
+		}
+
+		/**
+		 * Get the length of the vector.
+		 *
+		 * @return The length.
+		 */
+		float Length() const
+		{
+			return _mm_cvtss_f32(_mm_sqrt_ss(Intrinsics::Dot4(intrinsic, intrinsic)));
+		}
+
+		/**
+		 * Get the length of the vector, splatted to all the lanes.
+		 *
+		 * @return The splatted length.
+		 */
+		Vector4 LengthSplat() const
+		{
+			return std::move(_mm_sqrt_ps(Intrinsics::Dot4(intrinsic, intrinsic)));
+		}
+
+		/**
+		 * Get the reciprocal of the length of the vector.
+		 *
+		 * @tparam Policy: The precision policy (Precision::Exact, Precision::Refined or Precision::Fast).
+		 * @return The reciprocal length.
+		 */
+		template<class Policy = Precision::Exact>
+		float InvLength() const
+		{
+			return _mm_cvtss_f32(Policy::InverseSqrt(Intrinsics::Dot4(intrinsic, intrinsic)));
+		}
+
+		/**
+		 * Get the reciprocal of the length of the vector, splatted to all the lanes.
+		 *
+		 * @tparam Policy: The precision policy (Precision::Exact, Precision::Refined or Precision::Fast).
+		 * @return The splatted reciprocal length.
+		 */
+		template<class Policy = Precision::Exact>
+		Vector4 InvLengthSplat() const
+		{
+			return std::move(Policy::InverseSqrt(Intrinsics::Dot4(intrinsic, intrinsic)));
+		}
+
+		/**
+		 * Get the unit vector in the direction of this vector.
+		 * Normalizing a zero length vector results in NaN.
+		 *
+		 * @tparam Policy: The precision policy (Precision::Exact, Precision::Refined or Precision::Fast).
+		 * @return The normalized vector.
+		 */
+		template<class Policy = Precision::Exact>
+		Vector4 Normalize() const
+		{
+			return std::move(Policy::Normalize(intrinsic, Intrinsics::Dot4(intrinsic, intrinsic)));
+		}
+
+		/**
+		 * Get the squared distance between this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The squared distance.
+		 */
+		float DistanceSquared(const Vector4& other) const
+		{
+			return ((*this) - other).LengthSquared();
+		}
+
+		/**
+		 * Get the distance between this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The distance.
+		 */
+		float Distance(const Vector4& other) const
+		{
+			return ((*this) - other).Length();
+		}
+
+		/**
+		 * Get the distance between this and another vector, splatted to all the lanes.
+		 *
+		 * @param other: The other vector.
+		 * @return The splatted distance.
+		 */
+		Vector4 DistanceSplat(const Vector4& other) const
+		{
+			return ((*this) - other).LengthSplat();
 		}
 
 	public:
@@ -410,4 +685,8 @@ namespace QuickMath
 			IntrinsicTraits<float, 4>::Type intrinsic;
 		};
 	};
+
+	static_assert(sizeof(Vector4) == 16, "Invalid Vector4 size.");
+	static_assert(alignof(Vector4) == 16, "Invalid Vector4 alignment.");
+	static_assert(std::is_trivially_copyable<Vector4>::value, "Vector4 must be trivially copyable.");
 }
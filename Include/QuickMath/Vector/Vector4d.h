@@ -0,0 +1,553 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Vector4.h"
+
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * Double precision 4D vector for QuickMath.
+	 * This class uses an AVX register (or two SSE2 registers) to carry out the necessary calculations.
+	 */
+	class Vector4d final : public Vector<Vector4d, double>
+	{
+	public:
+		Vector4d() : intrinsic(Intrinsics::Set1Double(0.0)) {}
+
+		/**
+		 * Construct the vector without initializing it.
+		 */
+		explicit Vector4d(UninitializedTag) {}
+
+		/**
+		 * Set one value to all the data stored.
+		 *
+		 * @param value: Value to be stored.
+		 */
+		Vector4d(double value) : intrinsic(Intrinsics::Set1Double(value)) {}
+
+		/**
+		 * Set values to all the variables.
+		 *
+		 * @param value1: Value to be set to x/ r/ width.
+		 * @param value2: Value to be set to y/ g/ height.
+		 * @param value3: Value to be set to z/ b/ depth.
+		 * @param value4: Value to be set to w/ a/ zero.
+		 */
+		Vector4d(double value1, double value2, double value3, double value4) : intrinsic(Intrinsics::SetDouble(value1, value2, value3, value4)) {}
+
+		/**
+		 * Construct the vector using an intrinsic value.
+		 *
+		 * @param intrinsic: The intrinsic value.
+		 */
+		Vector4d(const IntrinsicTraits<double, 4>::Type& intrinsic) : intrinsic(intrinsic) {}
+
+		/**
+		 * Construct the vector by widening a single precision vector.
+		 *
+		 * @param vector: The single precision vector.
+		 */
+		explicit Vector4d(const Vector4& vector) : intrinsic(Intrinsics::ToDouble(vector.intrinsic)) {}
+
+		/**
+		 * Construct the vector using an initializer list.
+		 * The size of the list should be equal to 4.
+		 *
+		 * @param list: The initializer list.
+		 */
+		Vector4d(std::initializer_list<double> list) : intrinsic(Intrinsics::Set1Double(0.0))
+		{
+			if ((list.size() > 4) || (list.size() < 4))
+				return;
+
+			std::copy(list.begin(), list.end(), &x);
+		}
+
+		/**
+		 * Construct the vector using a double pointer.
+		 *
+		 * @param ptr: The double pointer.
+		 */
+		Vector4d(const double* ptr) : intrinsic(Intrinsics::Set1Double(0.0))
+		{
+			std::copy(ptr, ptr + 4, &x);
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the data to be accessed.
+		 * @return Double value at the index.
+		 */
+		double operator[](unsigned int index) const
+		{
+			return (operator const double* ())[index];
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the data to be accessed.
+		 * @return Double value at the index.
+		 */
+		double& operator[](unsigned int index)
+		{
+			return const_cast<double&>((operator const double* ())[index]);
+		}
+
+		/**
+		 * Return the address of this since it can be accessed by the [] operator.
+		 *
+		 * @return The address of the first element.
+		 */
+		operator double* ()
+		{
+			return &x;
+		}
+
+		/**
+		 * Return the address of this since it can be accessed by the [] operator.
+		 *
+		 * @return The address of the first element.
+		 */
+		operator const double* () const
+		{
+			return &x;
+		}
+
+		/**
+		 * Assign an intrinsic value to the vector.
+		 *
+		 * @param intrinsic: The intrinsic value to store.
+		 * @return The vector reference.
+		 */
+		Vector4d& operator=(const IntrinsicTraits<double, 4>::Type& intrinsic)
+		{
+			this->intrinsic = intrinsic;
+			return *this;
+		}
+
+		/**
+		 * Return the stored intrinsic value.
+		 *
+		 * @return The const intrinsic value.
+		 */
+		operator const IntrinsicTraits<double, 4>::Type() const
+		{
+			return intrinsic;
+		}
+
+		/**
+		 * Narrow the vector to single precision (rounded to nearest).
+		 *
+		 * @return The single precision vector.
+		 */
+		Vector4 ToVector4() const
+		{
+			return Vector4(Intrinsics::ToFloat(intrinsic));
+		}
+
+		/**
+		 * Get the single precision offset of this vector from an origin.
+		 * The subtraction is done in double precision, so large world coordinates close to the origin (for example the camera) keep their precision.
+		 *
+		 * @param origin: The origin.
+		 * @return The single precision offset.
+		 */
+		Vector4 RelativeTo(const Vector4d& origin) const
+		{
+			return Vector4(Intrinsics::ToFloat(Intrinsics::Sub(intrinsic, origin.intrinsic)));
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector4d operator+(const Vector4d& other) const
+		{
+			return Vector4d(Intrinsics::Add(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector4d operator-(const Vector4d& other) const
+		{
+			return Vector4d(Intrinsics::Sub(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector4d operator*(const Vector4d& other) const
+		{
+			return Vector4d(Intrinsics::Mul(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector4d operator/(const Vector4d& other) const
+		{
+			return Vector4d(Intrinsics::Div(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector4d operator+(const double& value) const
+		{
+			return *this + Vector4d(value);
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector4d operator-(const double& value) const
+		{
+			return *this - Vector4d(value);
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector4d operator*(const double& value) const
+		{
+			return *this * Vector4d(value);
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector4d operator/(const double& value) const
+		{
+			return *this / Vector4d(value);
+		}
+
+		/**
+		 * Multiply this by a vector and add another vector (this * multiplier + addend).
+		 * This compiles to a single fused multiply-add when AVX and FMA3 are available.
+		 *
+		 * @param multiplier: The vector to multiply with.
+		 * @param addend: The vector to add.
+		 * @return The calculated vector.
+		 */
+		Vector4d MulAdd(const Vector4d& multiplier, const Vector4d& addend) const
+		{
+			return Vector4d(Intrinsics::MulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a value and add a vector (this * multiplier + addend).
+		 * This compiles to a single fused multiply-add when AVX and FMA3 are available.
+		 *
+		 * @param multiplier: The value to multiply with.
+		 * @param addend: The vector to add.
+		 * @return The calculated vector.
+		 */
+		Vector4d MulAdd(const double& multiplier, const Vector4d& addend) const
+		{
+			return Vector4d(Intrinsics::MulAdd(intrinsic, Intrinsics::Set1Double(multiplier), addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a vector and subtract another vector (this * multiplier - subtrahend).
+		 * This compiles to a single fused multiply-subtract when AVX and FMA3 are available.
+		 *
+		 * @param multiplier: The vector to multiply with.
+		 * @param subtrahend: The vector to subtract.
+		 * @return The calculated vector.
+		 */
+		Vector4d MulSub(const Vector4d& multiplier, const Vector4d& subtrahend) const
+		{
+			return Vector4d(Intrinsics::MulSub(intrinsic, multiplier.intrinsic, subtrahend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a value and subtract a vector (this * multiplier - subtrahend).
+		 * This compiles to a single fused multiply-subtract when AVX and FMA3 are available.
+		 *
+		 * @param multiplier: The value to multiply with.
+		 * @param subtrahend: The vector to subtract.
+		 * @return The calculated vector.
+		 */
+		Vector4d MulSub(const double& multiplier, const Vector4d& subtrahend) const
+		{
+			return Vector4d(Intrinsics::MulSub(intrinsic, Intrinsics::Set1Double(multiplier), subtrahend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a vector and subtract the product from another vector (addend - this * multiplier).
+		 * This compiles to a single fused negated multiply-add when AVX and FMA3 are available.
+		 *
+		 * @param multiplier: The vector to multiply with.
+		 * @param addend: The vector to subtract the product from.
+		 * @return The calculated vector.
+		 */
+		Vector4d NegMulAdd(const Vector4d& multiplier, const Vector4d& addend) const
+		{
+			return Vector4d(Intrinsics::NegMulAdd(intrinsic, multiplier.intrinsic, addend.intrinsic));
+		}
+
+		/**
+		 * Multiply this by a value and subtract the product from a vector (addend - this * multiplier).
+		 * This compiles to a single fused negated multiply-add when AVX and FMA3 are available.
+		 *
+		 * @param multiplier: The value to multiply with.
+		 * @param addend: The vector to subtract the product from.
+		 * @return The calculated vector.
+		 */
+		Vector4d NegMulAdd(const double& multiplier, const Vector4d& addend) const
+		{
+			return Vector4d(Intrinsics::NegMulAdd(intrinsic, Intrinsics::Set1Double(multiplier), addend.intrinsic));
+		}
+
+		/**
+		 * Component-wise equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMaskd<4> Equal(const Vector4d& other) const
+		{
+			return VectorMaskd<4>(Intrinsics::CompareEqual(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Component-wise not equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMaskd<4> NotEqual(const Vector4d& other) const
+		{
+			return VectorMaskd<4>(Intrinsics::CompareNotEqual(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Component-wise less than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMaskd<4> Less(const Vector4d& other) const
+		{
+			return VectorMaskd<4>(Intrinsics::CompareLess(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Component-wise less than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMaskd<4> LessEqual(const Vector4d& other) const
+		{
+			return VectorMaskd<4>(Intrinsics::CompareLessEqual(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Component-wise greater than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMaskd<4> Greater(const Vector4d& other) const
+		{
+			return VectorMaskd<4>(Intrinsics::CompareGreater(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Component-wise greater than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMaskd<4> GreaterEqual(const Vector4d& other) const
+		{
+			return VectorMaskd<4>(Intrinsics::CompareGreaterEqual(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Is equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator==(const Vector4d& other) const
+		{
+			return Equal(other).All();
+		}
+
+		/**
+		 * Is not equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator!=(const Vector4d& other) const
+		{
+			return NotEqual(other).Any();
+		}
+
+		/**
+		 * Is less than operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator<(const Vector4d& other) const
+		{
+			return Less(other).Any();
+		}
+
+		/**
+		 * Is less than or equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator<=(const Vector4d& other) const
+		{
+			return LessEqual(other).All();
+		}
+
+		/**
+		 * Is grater than operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator>(const Vector4d& other) const
+		{
+			return Greater(other).Any();
+		}
+
+		/**
+		 * Is grater than or equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator>=(const Vector4d& other) const
+		{
+			return GreaterEqual(other).All();
+		}
+
+		/**
+		 * Compute the dot product of this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The dot product.
+		 */
+		double Dot(const Vector4d& other) const
+		{
+			return Intrinsics::FirstLane(Intrinsics::Dot4(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Get the squared length of the vector.
+		 *
+		 * @return The squared length.
+		 */
+		double LengthSquared() const
+		{
+			return Dot(*this);
+		}
+
+		/**
+		 * Get the length of the vector.
+		 *
+		 * @return The length.
+		 */
+		double Length() const
+		{
+			return Intrinsics::FirstLane(Intrinsics::Sqrt(Intrinsics::Dot4(intrinsic, intrinsic)));
+		}
+
+		/**
+		 * Get the unit vector in the direction of this vector.
+		 * Normalizing a zero length vector results in NaN.
+		 *
+		 * @return The normalized vector.
+		 */
+		Vector4d Normalize() const
+		{
+			return Vector4d(Intrinsics::Div(intrinsic, Intrinsics::Sqrt(Intrinsics::Dot4(intrinsic, intrinsic))));
+		}
+
+		/**
+		 * Get the squared distance between this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The squared distance.
+		 */
+		double DistanceSquared(const Vector4d& other) const
+		{
+			return ((*this) - other).LengthSquared();
+		}
+
+		/**
+		 * Get the distance between this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The distance.
+		 */
+		double Distance(const Vector4d& other) const
+		{
+			return ((*this) - other).Length();
+		}
+
+	public:
+		union
+		{
+			struct
+			{
+				double x, y, z, w;
+			};
+
+			struct
+			{
+				double r, g, b, a;
+			};
+
+			struct
+			{
+				double width, height, depth, zero;
+			};
+
+			IntrinsicTraits<double, 4>::Type intrinsic;
+		};
+	};
+
+	static_assert(sizeof(Vector4d) == 32, "Invalid Vector4d size.");
+	static_assert(alignof(Vector4d) == alignof(IntrinsicTraits<double, 4>::Type), "Invalid Vector4d alignment.");
+	static_assert(std::is_trivially_copyable<Vector4d>::value, "Vector4d must be trivially copyable.");
+}
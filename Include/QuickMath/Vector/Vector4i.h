@@ -0,0 +1,496 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "Vector4.h"
+
+#include <type_traits>
+
+namespace QuickMath
+{
+	/**
+	 * Integer 4D Vector for QuickMath.
+	 * This class uses an SSE2 integer register to carry out the necessary calculations.
+	 */
+	class Vector4i final : public Vector<Vector4i, int>
+	{
+	public:
+		Vector4i() : intrinsic(_mm_setzero_si128()) {}
+
+		/**
+		 * Construct the vector without initializing it.
+		 */
+		explicit Vector4i(UninitializedTag) {}
+
+		/**
+		 * Set one value to all the data stored.
+		 *
+		 * @param value: Value to be stored.
+		 */
+		Vector4i(int value) : intrinsic(_mm_set1_epi32(value)) {}
+
+		/**
+		 * Set values to all the variables.
+		 *
+		 * @param value1: Value to be set to x/ r/ width.
+		 * @param value2: Value to be set to y/ g/ height.
+		 * @param value3: Value to be set to z/ b/ depth.
+		 * @param value4: Value to be set to w/ a/ zero.
+		 */
+		Vector4i(int value1, int value2, int value3, int value4) : intrinsic(_mm_setr_epi32(value1, value2, value3, value4)) {}
+
+		/**
+		 * Construct the vector using an intrinsic value.
+		 *
+		 * @param intrinsic: The intrinsic value.
+		 */
+		Vector4i(const IntrinsicTraits<int, 4>::Type& intrinsic) : intrinsic(intrinsic) {}
+
+		/**
+		 * Construct the vector by converting a float vector.
+		 * The values are truncated towards zero (_mm_cvttps_epi32), like a C cast.
+		 *
+		 * @param vector: The float vector.
+		 */
+		explicit Vector4i(const Vector4& vector) : intrinsic(_mm_cvttps_epi32(vector.intrinsic)) {}
+
+		/**
+		 * Construct the vector using an initializer list.
+		 * The size of the list should be equal to 4.
+		 *
+		 * @param list: The initializer list.
+		 */
+		Vector4i(std::initializer_list<int> list) : intrinsic(_mm_setzero_si128())
+		{
+			if ((list.size() > 4) || (list.size() < 4))
+				return;
+
+			std::copy(list.begin(), list.end(), &x);
+		}
+
+		/**
+		 * Construct the vector using an integer pointer.
+		 *
+		 * @param ptr: The integer pointer.
+		 */
+		Vector4i(const int* ptr) : intrinsic(_mm_setzero_si128())
+		{
+			std::copy(ptr, ptr + 4, &x);
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the data to be accessed.
+		 * @return Integer value at the index.
+		 */
+		int operator[](unsigned int index) const
+		{
+			return (operator const int* ())[index];
+		}
+
+		/**
+		 * Get data using the [] operator.
+		 *
+		 * @param index: The index of the data to be accessed.
+		 * @return Integer value at the index.
+		 */
+		int& operator[](unsigned int index)
+		{
+			return const_cast<int&>((operator const int* ())[index]);
+		}
+
+		/**
+		 * Return the address of this since it can be accessed by the [] operator.
+		 *
+		 * @return The address of the first element.
+		 */
+		operator int* ()
+		{
+			return &x;
+		}
+
+		/**
+		 * Return the address of this since it can be accessed by the [] operator.
+		 *
+		 * @return The address of the first element.
+		 */
+		operator const int* () const
+		{
+			return &x;
+		}
+
+		/**
+		 * Assign an intrinsic value to the vector.
+		 *
+		 * @param intrinsic: The intrinsic value to store.
+		 * @return The vector reference.
+		 */
+		Vector4i& operator=(const IntrinsicTraits<int, 4>::Type& intrinsic)
+		{
+			this->intrinsic = intrinsic;
+			return *this;
+		}
+
+		/**
+		 * Return the stored intrinsic value.
+		 *
+		 * @return The const intrinsic value.
+		 */
+		operator const IntrinsicTraits<int, 4>::Type() const
+		{
+			return intrinsic;
+		}
+
+		/**
+		 * Convert the vector to a float vector (_mm_cvtepi32_ps).
+		 *
+		 * @return The float vector.
+		 */
+		Vector4 ToVector4() const
+		{
+			return Vector4(_mm_cvtepi32_ps(intrinsic));
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector4i operator+(const Vector4i& other) const
+		{
+			return Vector4i(_mm_add_epi32(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector4i operator-(const Vector4i& other) const
+		{
+			return Vector4i(_mm_sub_epi32(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Multiplication operator.
+		 * Only the low 32 bits of each product are kept, like the C multiplication.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector4i operator*(const Vector4i& other) const
+		{
+			return Vector4i(Intrinsics::MulLo(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Division operator.
+		 * There is no SIMD integer division, so this divides lane by lane.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector4i operator/(const Vector4i& other) const
+		{
+			Vector4i newVector;
+			newVector.x = x / other.x;
+			newVector.y = y / other.y;
+			newVector.z = z / other.z;
+			newVector.w = w / other.w;
+
+			return newVector;
+		}
+
+		/**
+		 * Addition operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector4i operator+(const int& value) const
+		{
+			return Vector4i(_mm_add_epi32(intrinsic, _mm_set1_epi32(value)));
+		}
+
+		/**
+		 * Subtraction operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector4i operator-(const int& value) const
+		{
+			return Vector4i(_mm_sub_epi32(intrinsic, _mm_set1_epi32(value)));
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector4i operator*(const int& value) const
+		{
+			return Vector4i(Intrinsics::MulLo(intrinsic, _mm_set1_epi32(value)));
+		}
+
+		/**
+		 * Division operator.
+		 *
+		 * @param value: RHS value.
+		 * @return The calculated vector.
+		 */
+		Vector4i operator/(const int& value) const
+		{
+			return *this / Vector4i(value);
+		}
+
+		/**
+		 * Bitwise AND operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector4i operator&(const Vector4i& other) const
+		{
+			return Vector4i(_mm_and_si128(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Bitwise OR operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector4i operator|(const Vector4i& other) const
+		{
+			return Vector4i(_mm_or_si128(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Bitwise XOR operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The calculated vector.
+		 */
+		Vector4i operator^(const Vector4i& other) const
+		{
+			return Vector4i(_mm_xor_si128(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Shift all the lanes left.
+		 *
+		 * @param count: The number of bits to shift by.
+		 * @return The shifted vector.
+		 */
+		Vector4i operator<<(int count) const
+		{
+			return Vector4i(_mm_slli_epi32(intrinsic, count));
+		}
+
+		/**
+		 * Shift all the lanes right, keeping the sign (arithmetic shift).
+		 *
+		 * @param count: The number of bits to shift by.
+		 * @return The shifted vector.
+		 */
+		Vector4i operator>>(int count) const
+		{
+			return Vector4i(_mm_srai_epi32(intrinsic, count));
+		}
+
+		/**
+		 * Shift all the lanes right, filling with zeros (logical shift).
+		 *
+		 * @param count: The number of bits to shift by.
+		 * @return The shifted vector.
+		 */
+		Vector4i ShiftRightLogical(int count) const
+		{
+			return Vector4i(_mm_srli_epi32(intrinsic, count));
+		}
+
+		/**
+		 * Get the component-wise minimum of this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The minimum vector.
+		 */
+		Vector4i Min(const Vector4i& other) const
+		{
+			return Vector4i(Intrinsics::Min(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Get the component-wise maximum of this and another vector.
+		 *
+		 * @param other: The other vector.
+		 * @return The maximum vector.
+		 */
+		Vector4i Max(const Vector4i& other) const
+		{
+			return Vector4i(Intrinsics::Max(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * Component-wise equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> Equal(const Vector4i& other) const
+		{
+			return VectorMask<4>(_mm_castsi128_ps(_mm_cmpeq_epi32(intrinsic, other.intrinsic)));
+		}
+
+		/**
+		 * Component-wise not equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> NotEqual(const Vector4i& other) const
+		{
+			return ~Equal(other);
+		}
+
+		/**
+		 * Component-wise less than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> Less(const Vector4i& other) const
+		{
+			return VectorMask<4>(_mm_castsi128_ps(_mm_cmplt_epi32(intrinsic, other.intrinsic)));
+		}
+
+		/**
+		 * Component-wise less than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> LessEqual(const Vector4i& other) const
+		{
+			return ~Greater(other);
+		}
+
+		/**
+		 * Component-wise greater than comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> Greater(const Vector4i& other) const
+		{
+			return VectorMask<4>(_mm_castsi128_ps(_mm_cmpgt_epi32(intrinsic, other.intrinsic)));
+		}
+
+		/**
+		 * Component-wise greater than or equal to comparison.
+		 *
+		 * @param other: RHS argument.
+		 * @return The lane mask.
+		 */
+		VectorMask<4> GreaterEqual(const Vector4i& other) const
+		{
+			return ~Less(other);
+		}
+
+		/**
+		 * Is equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator==(const Vector4i& other) const
+		{
+			return Equal(other).All();
+		}
+
+		/**
+		 * Is not equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator!=(const Vector4i& other) const
+		{
+			return NotEqual(other).Any();
+		}
+
+		/**
+		 * Is less than operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator<(const Vector4i& other) const
+		{
+			return Less(other).Any();
+		}
+
+		/**
+		 * Is less than or equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator<=(const Vector4i& other) const
+		{
+			return LessEqual(other).All();
+		}
+
+		/**
+		 * Is grater than operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator>(const Vector4i& other) const
+		{
+			return Greater(other).Any();
+		}
+
+		/**
+		 * Is grater than or equal operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return Boolean value.
+		 */
+		bool operator>=(const Vector4i& other) const
+		{
+			return GreaterEqual(other).All();
+		}
+
+	public:
+		union
+		{
+			struct
+			{
+				int x, y, z, w;
+			};
+
+			struct
+			{
+				int r, g, b, a;
+			};
+
+			struct
+			{
+				int width, height, depth, zero;
+			};
+
+			IntrinsicTraits<int, 4>::Type intrinsic;
+		};
+	};
+
+	static_assert(sizeof(Vector4i) == 16, "Invalid Vector4i size.");
+	static_assert(alignof(Vector4i) == 16, "Invalid Vector4i alignment.");
+	static_assert(std::is_trivially_copyable<Vector4i>::value, "Vector4i must be trivially copyable.");
+}
@@ -0,0 +1,379 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "../Intrinsics.h"
+
+#include <cstddef>
+
+namespace QuickMath
+{
+	/**
+	 * Lazy vector expressions.
+	 * Wrapping an operand with Lazy() (or LazyArray()) builds an expression tree instead of a temporary per operator.
+	 * The tree is evaluated in registers in one pass, and (a * b) + c and friends are fused into MulAdd/MulSub/NegMulAdd.
+	 *
+	 * Example: Vector4 result = Lazy(a) * s + Lazy(b) * t - Lazy(c);
+	 *
+	 * The expressions work with the vectors which store an SSE register (Vector3 and Vector4).
+	 */
+	namespace Expression
+	{
+		/**
+		 * Expression node base class.
+		 * All the expression operators take their operands as nodes.
+		 *
+		 * @tparam Derived: The node type.
+		 */
+		template<class Derived>
+		struct Node
+		{
+			/**
+			 * Dereference operator to return the node type.
+			 *
+			 * @return The node.
+			 */
+			const Derived& operator()() const { return *static_cast<const Derived*>(this); }
+		};
+
+		/**
+		 * Single vector leaf.
+		 * The vector is copied into the node, so the node does not dangle when the operand is a temporary.
+		 *
+		 * @tparam VectorType: The vector type.
+		 */
+		template<class VectorType>
+		class Value final : public Node<Value<VectorType>>
+		{
+		public:
+			typedef VectorType Type;
+
+			/**
+			 * Construct the leaf using a vector.
+			 *
+			 * @param vector: The vector.
+			 */
+			Value(const VectorType& vector) : intrinsic(vector.intrinsic) {}
+
+			/**
+			 * Evaluate the leaf.
+			 *
+			 * @param : The element index (ignored, a single vector is the same for every element).
+			 * @return The vector register.
+			 */
+			__m128 Evaluate(size_t) const { return intrinsic; }
+
+			/**
+			 * Evaluate the expression into a vector.
+			 *
+			 * @return The vector.
+			 */
+			operator Type() const { return Type(intrinsic); }
+
+		private:
+			__m128 intrinsic;
+		};
+
+		/**
+		 * Scalar leaf. The value is broadcast to all the lanes once, when the expression is built.
+		 *
+		 * @tparam VectorType: The vector type of the expression the scalar is used in.
+		 */
+		template<class VectorType>
+		class Scalar final : public Node<Scalar<VectorType>>
+		{
+		public:
+			typedef VectorType Type;
+
+			/**
+			 * Construct the leaf using a value.
+			 *
+			 * @param value: The value to broadcast.
+			 */
+			Scalar(float value) : intrinsic(_mm_set1_ps(value)) {}
+
+			/**
+			 * Evaluate the leaf.
+			 *
+			 * @param : The element index (ignored).
+			 * @return The broadcast register.
+			 */
+			__m128 Evaluate(size_t) const { return intrinsic; }
+
+		private:
+			__m128 intrinsic;
+		};
+
+		/**
+		 * Array leaf. Element i of the expression reads element i of the array.
+		 * The array is not copied, so it must outlive the expression.
+		 *
+		 * @tparam VectorType: The vector type.
+		 */
+		template<class VectorType>
+		class Array final : public Node<Array<VectorType>>
+		{
+		public:
+			typedef VectorType Type;
+
+			/**
+			 * Construct the leaf using an array pointer.
+			 *
+			 * @param pointer: The first element of the array.
+			 */
+			Array(const VectorType* pointer) : pointer(pointer) {}
+
+			/**
+			 * Evaluate the leaf.
+			 *
+			 * @param index: The element index.
+			 * @return The vector register of the element.
+			 */
+			__m128 Evaluate(size_t index) const { return pointer[index].intrinsic; }
+
+		private:
+			const VectorType* pointer;
+		};
+
+		/**
+		 * Binary operation node.
+		 *
+		 * @tparam Operation: The operation (Add, Subtract, Multiply or Divide).
+		 * @tparam LHS: The LHS node type.
+		 * @tparam RHS: The RHS node type.
+		 */
+		template<class Operation, class LHS, class RHS>
+		class Binary final : public Node<Binary<Operation, LHS, RHS>>
+		{
+		public:
+			typedef typename LHS::Type Type;
+
+			/**
+			 * Construct the node.
+			 *
+			 * @param lhs: The LHS node.
+			 * @param rhs: The RHS node.
+			 */
+			Binary(const LHS& lhs, const RHS& rhs) : lhs(lhs), rhs(rhs) {}
+
+			/**
+			 * Evaluate the node.
+			 *
+			 * @param index: The element index.
+			 * @return The result register.
+			 */
+			__m128 Evaluate(size_t index) const { return Operation::Apply(lhs.Evaluate(index), rhs.Evaluate(index)); }
+
+			/**
+			 * Evaluate the expression into a vector.
+			 *
+			 * @return The vector.
+			 */
+			operator Type() const { return Type(Evaluate(0)); }
+
+		public:
+			LHS lhs;
+			RHS rhs;
+		};
+
+		/**
+		 * Fused (ternary) operation node.
+		 *
+		 * @tparam Operation: The operation (MulAdd, MulSub or NegMulAdd).
+		 * @tparam A: The first multiplicand node type.
+		 * @tparam B: The second multiplicand node type.
+		 * @tparam C: The addend/ subtrahend node type.
+		 */
+		template<class Operation, class A, class B, class C>
+		class Ternary final : public Node<Ternary<Operation, A, B, C>>
+		{
+		public:
+			typedef typename A::Type Type;
+
+			/**
+			 * Construct the node.
+			 *
+			 * @param a: The first multiplicand.
+			 * @param b: The second multiplicand.
+			 * @param c: The addend/ subtrahend.
+			 */
+			Ternary(const A& a, const B& b, const C& c) : a(a), b(b), c(c) {}
+
+			/**
+			 * Evaluate the node.
+			 *
+			 * @param index: The element index.
+			 * @return The result register.
+			 */
+			__m128 Evaluate(size_t index) const { return Operation::Apply(a.Evaluate(index), b.Evaluate(index), c.Evaluate(index)); }
+
+			/**
+			 * Evaluate the expression into a vector.
+			 *
+			 * @return The vector.
+			 */
+			operator Type() const { return Type(Evaluate(0)); }
+
+		public:
+			A a;
+			B b;
+			C c;
+		};
+
+		struct Add { static __m128 Apply(__m128 lhs, __m128 rhs) { return _mm_add_ps(lhs, rhs); } };
+		struct Subtract { static __m128 Apply(__m128 lhs, __m128 rhs) { return _mm_sub_ps(lhs, rhs); } };
+		struct Multiply { static __m128 Apply(__m128 lhs, __m128 rhs) { return _mm_mul_ps(lhs, rhs); } };
+		struct Divide { static __m128 Apply(__m128 lhs, __m128 rhs) { return _mm_div_ps(lhs, rhs); } };
+
+		struct MulAdd { static __m128 Apply(__m128 a, __m128 b, __m128 c) { return Intrinsics::MulAdd(a, b, c); } };
+		struct MulSub { static __m128 Apply(__m128 a, __m128 b, __m128 c) { return Intrinsics::MulSub(a, b, c); } };
+		struct NegMulAdd { static __m128 Apply(__m128 a, __m128 b, __m128 c) { return Intrinsics::NegMulAdd(a, b, c); } };
+
+		template<class LHS, class RHS>
+		Binary<Add, LHS, RHS> operator+(const Node<LHS>& lhs, const Node<RHS>& rhs) { return Binary<Add, LHS, RHS>(lhs(), rhs()); }
+
+		template<class LHS, class RHS>
+		Binary<Subtract, LHS, RHS> operator-(const Node<LHS>& lhs, const Node<RHS>& rhs) { return Binary<Subtract, LHS, RHS>(lhs(), rhs()); }
+
+		template<class LHS, class RHS>
+		Binary<Multiply, LHS, RHS> operator*(const Node<LHS>& lhs, const Node<RHS>& rhs) { return Binary<Multiply, LHS, RHS>(lhs(), rhs()); }
+
+		template<class LHS, class RHS>
+		Binary<Divide, LHS, RHS> operator/(const Node<LHS>& lhs, const Node<RHS>& rhs) { return Binary<Divide, LHS, RHS>(lhs(), rhs()); }
+
+		/**
+		 * (a * b) + c is fused into MulAdd(a, b, c).
+		 */
+		template<class A, class B, class C>
+		Ternary<MulAdd, A, B, C> operator+(const Node<Binary<Multiply, A, B>>& lhs, const Node<C>& rhs)
+		{
+			return Ternary<MulAdd, A, B, C>(lhs().lhs, lhs().rhs, rhs());
+		}
+
+		/**
+		 * c + (a * b) is fused into MulAdd(a, b, c).
+		 */
+		template<class A, class B, class C>
+		Ternary<MulAdd, A, B, C> operator+(const Node<C>& lhs, const Node<Binary<Multiply, A, B>>& rhs)
+		{
+			return Ternary<MulAdd, A, B, C>(rhs().lhs, rhs().rhs, lhs());
+		}
+
+		/**
+		 * (a * b) + (c * d) is fused into MulAdd(a, b, c * d).
+		 */
+		template<class A, class B, class C, class D>
+		Ternary<MulAdd, A, B, Binary<Multiply, C, D>> operator+(const Node<Binary<Multiply, A, B>>& lhs, const Node<Binary<Multiply, C, D>>& rhs)
+		{
+			return Ternary<MulAdd, A, B, Binary<Multiply, C, D>>(lhs().lhs, lhs().rhs, rhs());
+		}
+
+		/**
+		 * (a * b) - c is fused into MulSub(a, b, c).
+		 */
+		template<class A, class B, class C>
+		Ternary<MulSub, A, B, C> operator-(const Node<Binary<Multiply, A, B>>& lhs, const Node<C>& rhs)
+		{
+			return Ternary<MulSub, A, B, C>(lhs().lhs, lhs().rhs, rhs());
+		}
+
+		/**
+		 * c - (a * b) is fused into NegMulAdd(a, b, c).
+		 */
+		template<class A, class B, class C>
+		Ternary<NegMulAdd, A, B, C> operator-(const Node<C>& lhs, const Node<Binary<Multiply, A, B>>& rhs)
+		{
+			return Ternary<NegMulAdd, A, B, C>(rhs().lhs, rhs().rhs, lhs());
+		}
+
+		/**
+		 * (a * b) - (c * d) is fused into MulSub(a, b, c * d).
+		 */
+		template<class A, class B, class C, class D>
+		Ternary<MulSub, A, B, Binary<Multiply, C, D>> operator-(const Node<Binary<Multiply, A, B>>& lhs, const Node<Binary<Multiply, C, D>>& rhs)
+		{
+			return Ternary<MulSub, A, B, Binary<Multiply, C, D>>(lhs().lhs, lhs().rhs, rhs());
+		}
+
+		template<class LHS>
+		auto operator+(const Node<LHS>& lhs, float rhs) -> decltype(lhs + Scalar<typename LHS::Type>(rhs)) { return lhs + Scalar<typename LHS::Type>(rhs); }
+
+		template<class RHS>
+		auto operator+(float lhs, const Node<RHS>& rhs) -> decltype(Scalar<typename RHS::Type>(lhs) + rhs) { return Scalar<typename RHS::Type>(lhs) + rhs; }
+
+		template<class LHS>
+		auto operator-(const Node<LHS>& lhs, float rhs) -> decltype(lhs - Scalar<typename LHS::Type>(rhs)) { return lhs - Scalar<typename LHS::Type>(rhs); }
+
+		template<class RHS>
+		auto operator-(float lhs, const Node<RHS>& rhs) -> decltype(Scalar<typename RHS::Type>(lhs) - rhs) { return Scalar<typename RHS::Type>(lhs) - rhs; }
+
+		template<class LHS>
+		auto operator*(const Node<LHS>& lhs, float rhs) -> decltype(lhs * Scalar<typename LHS::Type>(rhs)) { return lhs * Scalar<typename LHS::Type>(rhs); }
+
+		template<class RHS>
+		auto operator*(float lhs, const Node<RHS>& rhs) -> decltype(Scalar<typename RHS::Type>(lhs) * rhs) { return Scalar<typename RHS::Type>(lhs) * rhs; }
+
+		template<class LHS>
+		auto operator/(const Node<LHS>& lhs, float rhs) -> decltype(lhs / Scalar<typename LHS::Type>(rhs)) { return lhs / Scalar<typename LHS::Type>(rhs); }
+
+		template<class RHS>
+		auto operator/(float lhs, const Node<RHS>& rhs) -> decltype(Scalar<typename RHS::Type>(lhs) / rhs) { return Scalar<typename RHS::Type>(lhs) / rhs; }
+	}
+
+	/**
+	 * Start a lazy expression from a vector.
+	 *
+	 * @tparam Type: The vector type.
+	 * @param vector: The vector.
+	 * @return The expression leaf.
+	 */
+	template<class Type>
+	Expression::Value<Type> Lazy(const Type& vector)
+	{
+		return Expression::Value<Type>(vector);
+	}
+
+	/**
+	 * Start a lazy expression from an array of vectors.
+	 * Use Evaluate(output, count, expression) to evaluate the expression for every element.
+	 *
+	 * @tparam Type: The vector type.
+	 * @param array: The first element of the array.
+	 * @return The expression leaf.
+	 */
+	template<class Type>
+	Expression::Array<Type> LazyArray(const Type* array)
+	{
+		return Expression::Array<Type>(array);
+	}
+
+	/**
+	 * Evaluate a lazy expression into a vector.
+	 *
+	 * @tparam Derived: The expression type.
+	 * @param expression: The expression.
+	 * @return The vector.
+	 */
+	template<class Derived>
+	typename Derived::Type Evaluate(const Expression::Node<Derived>& expression)
+	{
+		return typename Derived::Type(expression().Evaluate(0));
+	}
+
+	/**
+	 * Evaluate a lazy expression for a whole array in one loop.
+	 * Element i of every array operand is used for element i of the output. The output may alias an input array.
+	 *
+	 * @tparam Derived: The expression type.
+	 * @param output: The output array.
+	 * @param count: The number of elements to evaluate.
+	 * @param expression: The expression.
+	 */
+	template<class Derived>
+	void Evaluate(typename Derived::Type* output, size_t count, const Expression::Node<Derived>& expression)
+	{
+		const Derived& root = expression();
+		for (size_t i = 0; i < count; i++)
+			output[i].intrinsic = root.Evaluate(i);
+	}
+}
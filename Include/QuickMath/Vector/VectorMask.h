@@ -0,0 +1,585 @@
+// Copyright (c) 2021 Dhiraj Wishal
+
+#pragma once
+
+#include "../Intrinsics.h"
+
+namespace QuickMath
+{
+	/**
+	 * Lane mask returned by the component-wise vector comparisons.
+	 * Each lane is either all ones (true) or all zeros (false). Only the lowest Lanes lanes are considered.
+	 *
+	 * @tparam Lanes: The number of lanes in use.
+	 */
+	template<int Lanes>
+	class VectorMask
+	{
+	public:
+		/**
+		 * The bits of the used lanes in the movemask result.
+		 */
+		static constexpr int LaneBits = (1 << Lanes) - 1;
+
+		VectorMask() : intrinsic(_mm_setzero_ps()) {}
+
+		/**
+		 * Construct the mask using an intrinsic value.
+		 *
+		 * @param intrinsic: The intrinsic value, usually the result of a _mm_cmp*_ps instruction.
+		 */
+		VectorMask(const typename IntrinsicTraits<float, Lanes>::Type& intrinsic) : intrinsic(intrinsic) {}
+
+		/**
+		 * Return the stored intrinsic value.
+		 *
+		 * @return The const intrinsic value.
+		 */
+		operator const typename IntrinsicTraits<float, Lanes>::Type() const
+		{
+			return intrinsic;
+		}
+
+		/**
+		 * Get the lane bits of the mask. Bit n is set when lane n is true.
+		 *
+		 * @return The lane bits.
+		 */
+		int Bits() const
+		{
+			return _mm_movemask_ps(intrinsic) & LaneBits;
+		}
+
+		/**
+		 * Check if all the lanes are true.
+		 *
+		 * @return Boolean value.
+		 */
+		bool All() const
+		{
+			return Bits() == LaneBits;
+		}
+
+		/**
+		 * Check if at least one lane is true.
+		 *
+		 * @return Boolean value.
+		 */
+		bool Any() const
+		{
+			return Bits() != 0;
+		}
+
+		/**
+		 * Check if all the lanes are false.
+		 *
+		 * @return Boolean value.
+		 */
+		bool None() const
+		{
+			return Bits() == 0;
+		}
+
+		/**
+		 * AND operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The combined mask.
+		 */
+		VectorMask operator&(const VectorMask& other) const
+		{
+			return VectorMask(_mm_and_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * OR operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The combined mask.
+		 */
+		VectorMask operator|(const VectorMask& other) const
+		{
+			return VectorMask(_mm_or_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * XOR operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The combined mask.
+		 */
+		VectorMask operator^(const VectorMask& other) const
+		{
+			return VectorMask(_mm_xor_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * NOT operator.
+		 *
+		 * @return The inverted mask.
+		 */
+		VectorMask operator~() const
+		{
+			return VectorMask(_mm_xor_ps(intrinsic, _mm_castsi128_ps(_mm_set1_epi32(-1))));
+		}
+
+	public:
+		typename IntrinsicTraits<float, Lanes>::Type intrinsic;
+	};
+
+	/**
+	 * Lane mask returned by the component-wise double precision vector comparisons.
+	 * Each lane is either all ones (true) or all zeros (false). Only the lowest Lanes lanes are considered.
+	 *
+	 * @tparam Lanes: The number of lanes in use.
+	 */
+	template<int Lanes>
+	class VectorMaskd
+	{
+	public:
+		/**
+		 * The bits of the used lanes in the movemask result.
+		 */
+		static constexpr int LaneBits = (1 << Lanes) - 1;
+
+		VectorMaskd() : intrinsic(Intrinsics::Set1Double(0.0)) {}
+
+		/**
+		 * Construct the mask using an intrinsic value.
+		 *
+		 * @param intrinsic: The intrinsic value, usually the result of an Intrinsics::Compare* function.
+		 */
+		VectorMaskd(const IntrinsicTraits<double, 4>::Type& intrinsic) : intrinsic(intrinsic) {}
+
+		/**
+		 * Return the stored intrinsic value.
+		 *
+		 * @return The const intrinsic value.
+		 */
+		operator const IntrinsicTraits<double, 4>::Type() const
+		{
+			return intrinsic;
+		}
+
+		/**
+		 * Get the lane bits of the mask. Bit n is set when lane n is true.
+		 *
+		 * @return The lane bits.
+		 */
+		int Bits() const
+		{
+			return Intrinsics::MoveMask(intrinsic) & LaneBits;
+		}
+
+		/**
+		 * Check if all the lanes are true.
+		 *
+		 * @return Boolean value.
+		 */
+		bool All() const
+		{
+			return Bits() == LaneBits;
+		}
+
+		/**
+		 * Check if at least one lane is true.
+		 *
+		 * @return Boolean value.
+		 */
+		bool Any() const
+		{
+			return Bits() != 0;
+		}
+
+		/**
+		 * Check if all the lanes are false.
+		 *
+		 * @return Boolean value.
+		 */
+		bool None() const
+		{
+			return Bits() == 0;
+		}
+
+		/**
+		 * AND operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The combined mask.
+		 */
+		VectorMaskd operator&(const VectorMaskd& other) const
+		{
+			return VectorMaskd(Intrinsics::And(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * OR operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The combined mask.
+		 */
+		VectorMaskd operator|(const VectorMaskd& other) const
+		{
+			return VectorMaskd(Intrinsics::Or(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * XOR operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The combined mask.
+		 */
+		VectorMaskd operator^(const VectorMaskd& other) const
+		{
+			return VectorMaskd(Intrinsics::Xor(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * NOT operator.
+		 *
+		 * @return The inverted mask.
+		 */
+		VectorMaskd operator~() const
+		{
+			const IntrinsicTraits<double, 4>::Type zero = Intrinsics::Set1Double(0.0);
+			return VectorMaskd(Intrinsics::Xor(intrinsic, Intrinsics::CompareEqual(zero, zero)));
+		}
+
+	public:
+		IntrinsicTraits<double, 4>::Type intrinsic;
+	};
+
+#if SSE_INSTR_SET > 6
+	/**
+	 * 8 lane mask returned by the Packet8 comparisons.
+	 * Each lane is either all ones (true) or all zeros (false).
+	 */
+	template<>
+	class VectorMask<8>
+	{
+	public:
+		/**
+		 * The bits of the used lanes in the movemask result.
+		 */
+		static constexpr int LaneBits = 0xFF;
+
+		VectorMask() : intrinsic(_mm256_setzero_ps()) {}
+
+		/**
+		 * Construct the mask using an intrinsic value.
+		 *
+		 * @param intrinsic: The intrinsic value, usually the result of a _mm256_cmp_ps instruction.
+		 */
+		VectorMask(const IntrinsicTraits<float, 8>::Type& intrinsic) : intrinsic(intrinsic) {}
+
+		/**
+		 * Return the stored intrinsic value.
+		 *
+		 * @return The const intrinsic value.
+		 */
+		operator const IntrinsicTraits<float, 8>::Type() const
+		{
+			return intrinsic;
+		}
+
+		/**
+		 * Get the lane bits of the mask. Bit n is set when lane n is true.
+		 *
+		 * @return The lane bits.
+		 */
+		int Bits() const
+		{
+			return _mm256_movemask_ps(intrinsic);
+		}
+
+		/**
+		 * Check if all the lanes are true.
+		 *
+		 * @return Boolean value.
+		 */
+		bool All() const
+		{
+			return Bits() == LaneBits;
+		}
+
+		/**
+		 * Check if at least one lane is true.
+		 *
+		 * @return Boolean value.
+		 */
+		bool Any() const
+		{
+			return _mm256_testz_ps(intrinsic, intrinsic) == 0;
+		}
+
+		/**
+		 * Check if all the lanes are false.
+		 *
+		 * @return Boolean value.
+		 */
+		bool None() const
+		{
+			return _mm256_testz_ps(intrinsic, intrinsic) != 0;
+		}
+
+		/**
+		 * AND operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The combined mask.
+		 */
+		VectorMask operator&(const VectorMask& other) const
+		{
+			return VectorMask(_mm256_and_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * OR operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The combined mask.
+		 */
+		VectorMask operator|(const VectorMask& other) const
+		{
+			return VectorMask(_mm256_or_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * XOR operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The combined mask.
+		 */
+		VectorMask operator^(const VectorMask& other) const
+		{
+			return VectorMask(_mm256_xor_ps(intrinsic, other.intrinsic));
+		}
+
+		/**
+		 * NOT operator.
+		 *
+		 * @return The inverted mask.
+		 */
+		VectorMask operator~() const
+		{
+			return VectorMask(_mm256_xor_ps(intrinsic, _mm256_castsi256_ps(_mm256_set1_epi32(-1))));
+		}
+
+	public:
+		IntrinsicTraits<float, 8>::Type intrinsic;
+	};
+
+#endif // SSE_INSTR_SET > 6
+
+#if SSE_INSTR_SET > 8
+	/**
+	 * 16 lane mask returned by the Packet16 comparisons.
+	 * AVX-512 keeps compare results in mask registers, so the mask is one bit per lane (__mmask16).
+	 */
+	template<>
+	class VectorMask<16>
+	{
+	public:
+		/**
+		 * The bits of the used lanes.
+		 */
+		static constexpr int LaneBits = 0xFFFF;
+
+		VectorMask() : intrinsic(0) {}
+
+		/**
+		 * Construct the mask using a mask register value.
+		 *
+		 * @param intrinsic: The mask value, usually the result of a _mm512_cmp_ps_mask instruction.
+		 */
+		VectorMask(__mmask16 intrinsic) : intrinsic(intrinsic) {}
+
+		/**
+		 * Create a mask where the first count lanes are true.
+		 * This is used to handle the tail of an array with masked loads and stores.
+		 *
+		 * @param count: The number of lanes to set (0 - 16).
+		 * @return The mask.
+		 */
+		static VectorMask FirstLanes(int count)
+		{
+			return VectorMask(static_cast<__mmask16>((1u << count) - 1u));
+		}
+
+		/**
+		 * Return the stored mask value.
+		 *
+		 * @return The mask value.
+		 */
+		operator __mmask16() const
+		{
+			return intrinsic;
+		}
+
+		/**
+		 * Get the lane bits of the mask. Bit n is set when lane n is true.
+		 *
+		 * @return The lane bits.
+		 */
+		int Bits() const
+		{
+			return intrinsic;
+		}
+
+		/**
+		 * Check if all the lanes are true.
+		 *
+		 * @return Boolean value.
+		 */
+		bool All() const
+		{
+			return intrinsic == LaneBits;
+		}
+
+		/**
+		 * Check if at least one lane is true.
+		 *
+		 * @return Boolean value.
+		 */
+		bool Any() const
+		{
+			return intrinsic != 0;
+		}
+
+		/**
+		 * Check if all the lanes are false.
+		 *
+		 * @return Boolean value.
+		 */
+		bool None() const
+		{
+			return intrinsic == 0;
+		}
+
+		/**
+		 * AND operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The combined mask.
+		 */
+		VectorMask operator&(const VectorMask& other) const
+		{
+			return VectorMask(static_cast<__mmask16>(intrinsic & other.intrinsic));
+		}
+
+		/**
+		 * OR operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The combined mask.
+		 */
+		VectorMask operator|(const VectorMask& other) const
+		{
+			return VectorMask(static_cast<__mmask16>(intrinsic | other.intrinsic));
+		}
+
+		/**
+		 * XOR operator.
+		 *
+		 * @param other: RHS argument.
+		 * @return The combined mask.
+		 */
+		VectorMask operator^(const VectorMask& other) const
+		{
+			return VectorMask(static_cast<__mmask16>(intrinsic ^ other.intrinsic));
+		}
+
+		/**
+		 * NOT operator.
+		 *
+		 * @return The inverted mask.
+		 */
+		VectorMask operator~() const
+		{
+			return VectorMask(static_cast<__mmask16>(~intrinsic));
+		}
+
+	public:
+		__mmask16 intrinsic;
+	};
+
+#endif // SSE_INSTR_SET > 8
+
+	/**
+	 * Select lanes from two vectors using a mask.
+	 * This is branch free and uses _mm_blendv_ps on SSE4.1 and later.
+	 *
+	 * @tparam Lanes: The number of lanes of the mask.
+	 * @tparam Type: The vector type.
+	 * @param mask: The mask to select with.
+	 * @param ifTrue: The vector to take the lanes from where the mask is true.
+	 * @param ifFalse: The vector to take the lanes from where the mask is false.
+	 * @return The selected vector.
+	 */
+	template<int Lanes, class Type>
+	Type Select(const VectorMask<Lanes>& mask, const Type& ifTrue, const Type& ifFalse)
+	{
+#if SSE_INSTR_SET > 4
+		return Type(_mm_blendv_ps(ifFalse, ifTrue, mask.intrinsic));
+
+#else
+		return Type(_mm_or_ps(_mm_and_ps(mask.intrinsic, ifTrue), _mm_andnot_ps(mask.intrinsic, ifFalse)));
+
+#endif // SSE_INSTR_SET > 4
+	}
+
+	/**
+	 * Select lanes from two double precision vectors using a mask.
+	 * This is branch free and uses _mm256_blendv_pd on AVX and _mm_blendv_pd on SSE4.1.
+	 *
+	 * @tparam Lanes: The number of lanes of the mask.
+	 * @tparam Type: The vector type.
+	 * @param mask: The mask to select with.
+	 * @param ifTrue: The vector to take the lanes from where the mask is true.
+	 * @param ifFalse: The vector to take the lanes from where the mask is false.
+	 * @return The selected vector.
+	 */
+	template<int Lanes, class Type>
+	Type Select(const VectorMaskd<Lanes>& mask, const Type& ifTrue, const Type& ifFalse)
+	{
+		return Type(Intrinsics::Blend(mask.intrinsic, ifTrue.intrinsic, ifFalse.intrinsic));
+	}
+
+#if SSE_INSTR_SET > 6
+	/**
+	 * Select lanes from two 8 lane packets using a mask.
+	 * This is branch free and uses _mm256_blendv_ps.
+	 *
+	 * @tparam Type: The packet type.
+	 * @param mask: The mask to select with.
+	 * @param ifTrue: The packet to take the lanes from where the mask is true.
+	 * @param ifFalse: The packet to take the lanes from where the mask is false.
+	 * @return The selected packet.
+	 */
+	template<class Type>
+	Type Select(const VectorMask<8>& mask, const Type& ifTrue, const Type& ifFalse)
+	{
+		return Type(_mm256_blendv_ps(ifFalse.intrinsic, ifTrue.intrinsic, mask.intrinsic));
+	}
+
+#endif // SSE_INSTR_SET > 6
+
+#if SSE_INSTR_SET > 8
+	/**
+	 * Select lanes from two 16 lane packets using a mask.
+	 * This is a single _mm512_mask_blend_ps.
+	 *
+	 * @tparam Type: The packet type.
+	 * @param mask: The mask to select with.
+	 * @param ifTrue: The packet to take the lanes from where the mask is true.
+	 * @param ifFalse: The packet to take the lanes from where the mask is false.
+	 * @return The selected packet.
+	 */
+	template<class Type>
+	Type Select(const VectorMask<16>& mask, const Type& ifTrue, const Type& ifFalse)
+	{
+		return Type(_mm512_mask_blend_ps(mask.intrinsic, ifFalse.intrinsic, ifTrue.intrinsic));
+	}
+
+#endif // SSE_INSTR_SET > 8
+}